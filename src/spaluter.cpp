@@ -12,10 +12,15 @@
 // Free Run mode stacks harmonic intervals (octaves, fifths, etc.),
 // CV mode triggers overlapping voices from gate+pitch CV (Rings-style).
 //
-// Architecture:
-//   DRAM  (~312 KB) — pre-computed pulsaret/window lookup tables + sample buffer
-//   DTC   (~424 B)  — per-sample hot state (4 voices × phase, envelope, DC filter, PRNG)
-//   SRAM  (~1 KB)   — algorithm struct, cached params, WAV request state
+// Architecture (sizes from sizeof, default 2048-point tables):
+//   DRAM  (~678 KB) — pulsaret/window banks (120 KB), X/Y tilt rows (160 KB),
+//                     band-limited mips (~163 KB), sample buffer (~188 KB),
+//                     double-buffered working tables (48 KB)
+//         + options — spectral morph grid (24 KB per Morph step above 1,
+//                     216 KB at the default 4), period cache (128 KB)
+//   DTC   (~6 KB)   — per-sample hot state (4 voices × phase, envelope, rotors, tails, noise PRNGs)
+//   SRAM  (~10 KB)  — algorithm struct: parameter copy (~3–5 KB), period cache
+//                     keys (~3 KB), morph grid pointers, cached params, WAV request
 //
 // Signal chain (per sample):
 //   For each voice:
@@ -45,24 +50,118 @@
 // ============================================================
 // Table sizes
 // ============================================================
+// Building with -DSPALUTER_COMPACT_TABLES uses 512-point tables (a quarter
+// of the table DRAM); Hermite interpolation then becomes the default.
+#ifdef SPALUTER_COMPACT_TABLES
+static const int kTableSize = 512;          // Samples per waveform/window table
+static const int kDefaultInterp = 1;        // Hermite
+#else
 static const int kTableSize = 2048;         // Samples per waveform/window table
+static const int kDefaultInterp = 0;        // Linear
+#endif
 static const int kNumPulsarets = 10;        // Number of pulsaret waveforms
 static const int kNumWindows = 5;           // Number of window functions
 static const int kSampleBufferSize = 48000; // Max sample frames (1 sec at 48kHz)
+static const int kWindowBuildChunk = 256;   // Working window points rendered per block
+static const int kMaxVoices = 4;            // Voice slots
+static const int kPeriodCacheSize = 4096;   // Period cache points per voice and channel (power of two)
+static constexpr float kFormantMaxHz = 8000.0f; // Formant frequency ceiling
+static const float kLog2A4 = 8.78135971f;   // log2(440): MIDI note 69 in log2 Hz
+static const int kMaxSyncEdges = 64;        // Sync edges kept per block (extras are ignored)
+static const int kMaxPolyEdges = 32;        // Poly CV gate edges kept per block (later ones wait a block)
+
+// Band-limited pulsaret levels: level L (1..kMipLevels) holds
+// kTableSize/4 >> (L-1) harmonics, down to the fundamental alone, in
+// a table of kTableSize >> (L-1) points but never fewer than
+// kMipMinSize; level 0 is the full bank table. Levels are packed per
+// pulsaret, level L starting at 2 * (kTableSize - size) until the
+// tables stop shrinking at kMipFloorLevel, then kMipMinSize apart.
+static constexpr int ilog2(int n) { return n <= 1 ? 0 : 1 + ilog2(n >> 1); }
+static const int kMipMinSize = 32;
+static const int kMipLevels = ilog2(kTableSize / 4) + 1;
+static const int kMipFloorLevel = ilog2(kTableSize / kMipMinSize) + 1;
+static const int kMipTotal = 2 * (kTableSize - kMipMinSize) + (kMipLevels - kMipFloorLevel + 1) * kMipMinSize;
+
+static constexpr int mipHarmonics(int level) { return (kTableSize / 4) >> (level - 1); }
+static constexpr int mipSize(int level)
+{
+	return level < kMipFloorLevel ? kTableSize >> (level - 1) : kMipMinSize;
+}
+static constexpr int mipOffset(int level)
+{
+	return level <= kMipFloorLevel ? 2 * (kTableSize - (kTableSize >> (level - 1)))
+	                               : 2 * (kTableSize - kMipMinSize) + (level - kMipFloorLevel) * kMipMinSize;
+}
+
+// Spectral morph grid: tables per adjacent pulsaret pair (Morph Steps
+// specification). Steps - 1 intermediates are stored per pair.
+static const int kMorphStepsDefault = 4;
+static const int kMorphStepsMax = 8;
+static const int kMorphGridMax = (kNumPulsarets - 1) * kMorphStepsMax + 1;
+
+// Additive user pulsaret
+static const int kAddHarmonics = 16;        // Harmonics with amplitude and phase
+
+// Live noise pulsaret
+static const int kNoiseBlock = 32;          // Samples between Band noise coefficient updates
+enum { kNoiseTable, kNoiseWhite, kNoisePink, kNoiseBand };
+
+// ============================================================
+// Step sequencer lanes
+// ============================================================
+static const int kSeqMaxSteps = 16;         // Steps per lane
+static const int kSeqLaneParams = 2 + kSeqMaxSteps; // Length + Div + steps
+
+enum {
+	kLaneFormant,   // Hz offset added to every formant
+	kLaneDuty,      // Duty offset (fraction of period)
+	kLaneAmp,       // Amplitude multiplier
+	kLanePan,       // Pan position offset
+	kNumLanes,
+};
+
+// Raw step value → lane units
+static const float kSeqLaneScale[kNumLanes] = { 1.0f, 0.01f, 0.01f, 0.01f };
 
 // ============================================================
 // Memory structures
 // ============================================================
 
-// DRAM: large pre-computed lookup tables and sample buffer (~312 KB)
+// One point of two adjacent morph tables in the interleaved layout:
+// each table's value and its delta to the next point, so a morphing
+// lerp read touches one 16-byte entry (one cache line) instead of four
+// floats spread across two tables 8 KB apart.
+struct _tablePair {
+	float v0, d0;   // Table k
+	float v1, d1;   // Table k + 1
+};
+
+// DRAM: large pre-computed lookup tables and sample buffer (~678 KB)
 struct _pulsarDRAM {
 	float pulsaretTables[kNumPulsarets][kTableSize]; // 10 waveforms: sine, sine×2, sine×3, sinc, tri, saw, square, formant, pulse, noise
 	float windowTables[kNumWindows][kTableSize];     // 5 windows: rectangular, gaussian, hann, exp decay, linear decay
+	float windowWork[2][kTableSize];                 // Parametric/sample window, double-buffered (front read, back built)
+	float pulsaretTilt[2][kNumPulsarets][kTableSize]; // Y axis rows: -6 dB/oct (dark) and +6 dB/oct (bright) tilt
+	float pulsaretWork[2][kTableSize];               // Resolved X/Y pulsaret, double-buffered (front read, back built)
+	float additiveWork[2][kTableSize];               // Additive user pulsaret, double-buffered (front read, back built)
+	float pulsaretMips[kNumPulsarets][kMipTotal];    // Band-limited levels of each pulsaret (~2x the bank)
+#ifdef SPALUTER_INTERLEAVED_TABLES
+	_tablePair pulsaretPairs[kNumPulsarets - 1][kTableSize]; // Interleaved copies of the banks above (+416 KB)
+	_tablePair windowPairs[kNumWindows - 1][kTableSize];
+#endif
 	float sampleBuffer[kSampleBufferSize];           // WAV sample data for sample-based pulsarets
 };
 
+// Optional DRAM after _pulsarDRAM and the morph grid: one period of each
+// steady voice's formant sum, L/R (128 KB, Period cache specification)
+typedef float _periodCacheTables[kMaxVoices][2][kPeriodCacheSize];
+
+// Double-buffered working tables whose front a voice latches with its
+// snapshot, so a rebuild never changes a pulsaret under a voice
+enum { kWorkWindow, kWorkPulsaret, kWorkAdditive, kNumWorkTables };
+
 // Per-voice parameter snapshot — frozen when voice is released
-// so releasing voices maintain their timbral state (~96 bytes)
+// so releasing voices maintain their timbral state (~160 bytes)
 struct _voiceSnapshot {
 	float pulsaretIdx;
 	float windowIdx;
@@ -71,6 +170,7 @@ struct _voiceSnapshot {
 	int formantCount;
 	float invFormantCount;
 	float formantHz[3];
+	float pan[3];             // Pan positions after CV (for the pan lane)
 	float panL[3];
 	float panR[3];
 	int maskMode;
@@ -82,23 +182,105 @@ struct _voiceSnapshot {
 	float amplitude;
 	int useSample;
 	float sampleRateRatio;
-	float glissonDepth;       // ±2.0 range (mapped from param)
+	float glissDepth[3];      // Glisson octaves per period for each formant (±2.0 × formant scale)
+	int glissCurve;           // kGliss*: sweep curve
 	float ampJitterAmount;    // 0.0–1.0
 	float timingJitterAmount; // 0.0–1.0
 	bool perFormantMask;
+	int windowPath;           // kWindowPath*: how the window is evaluated
+	bool sinePath;            // Sine-family pulsaret from the quadrature oscillator
+	bool pulsaretWork;        // Read the resolved 2D X/Y working table
+	uint8_t workFront[kNumWorkTables]; // kWork*: buffer of each working table latched with the snapshot
+	bool additive;            // Read the additive user pulsaret table
+	int noiseType;            // kNoise*: colour of the live noise pulsaret
+	bool liveNoise;           // Noise slot (index above 8) uses live noise
 	bool formantTrack;
+	bool harmLock;            // Formant ratios snap to whole harmonics
+};
+
+// Window evaluation paths, chosen per block from the window settings.
+// Integer window indices with a closed form skip the table reads.
+enum {
+	kWindowPathMorph,   // Crossfade between two bank tables
+	kWindowPathRect,    // Window 0.0: constant 1
+	kWindowPathHann,    // Window 2.0: rotation recurrence per pulsaret
+	kWindowPathLinear,  // Window 4.0: 1 - p
+	kWindowPathWork,    // Working table (parametric/sample window)
+};
+
+// Recurrence state for one pulsaret: the Hann window rotator, the
+// sine-family quadrature oscillator and the glisson sweep. All are
+// resynced exactly at each pulse and carried into the tail slot if the
+// pulsaret overlaps.
+enum { kRotorWin = 1, kRotorOsc = 2, kRotorGliss = 4 };
+
+struct _pulsaretRotor {
+	float winC, winS;           // cos/sin(2*pi*pulsaretPhase)
+	float winPhase;             // Pulsaret phase the window rotator is at
+	float oscC, oscS;           // cos/sin(2*pi*tablePhase)
+	float oscCd, oscSd;         // Per-sample rotation (cos/sin of oscStep)
+	float oscStep;              // Oscillator step in radians per sample
+	float gliss;                // Exp glisson: current multiplier
+	float glissStep;            // Exp: per-sample ratio; Linear/S-curve: end multiplier - 1
+	uint8_t glissCurve;         // Curve the glisson state was set up for
+	uint8_t valid;              // kRotorWin | kRotorOsc | kRotorGliss: recurrences in step
+};
+
+// Live noise stream: the PRNG and colour filter state only; samples
+// are generated as they are played.
+struct _noiseSource {
+	uint32_t seed;              // xorshift32 state (never 0)
+	float b0, b1, b2;           // Pink filter state (Kellet economy)
+	float ic1, ic2;             // Band-pass SVF integrator state
+};
+
+// Band noise SVF coefficients for one formant, shared by its streams
+struct _noiseBand {
+	float a1, a2, a3;
+	float gain;
+};
+
+// A pulsaret still sounding after its period ended (duty > 100%).
+// Keeps the phase, duty, ratio and mask it started with so overlapping
+// pulsarets render independently of the one started by the next pulse.
+static const int kMaxTails = 3;  // + current pulsaret = 4 concurrent per formant
+static const float kMaxDuty = 4.0f;
+
+struct _pulsaretTail {
+	float age;                  // Master phase elapsed since its pulse (retired when >= duty)
+	float duty;                 // Pulsaret length in periods
+	float invDuty;              // 1 / duty
+	float ratio;                // Pulsaret cycles per period
+	float mask;                 // Mask gain frozen when the next pulse started
+	int mip;                    // Band-limited pulsaret level
+	_pulsaretRotor rot;         // Recurrences carried over from the current pulsaret
 };
 
-// Per-voice state (~200 bytes each with snapshot)
+// Per-voice state (~1.5 KB each: tails ~610 B, noise ~290 B, snapshot ~160 B, rotors ~130 B)
 struct _pulsarVoice {
 	// Master oscillator
 	float masterPhase;          // 0.0–1.0 sawtooth phase accumulator
-	float fundamentalHz;        // Current fundamental frequency (smoothed by glide)
-	float targetFundamentalHz;  // Target frequency from MIDI note or interval
-	float glideCoeff;           // One-pole glide/portamento coefficient
+	bool phaseRestart;          // Next wrap was forced by startVoicePhase (spawns no tails)
+	bool forceLatch;            // Latch the snapshot on the next sample (a new note)
+	float fundamentalHz;        // Glided pitch in Hz at the last tick (0 = never started)
+	float pitchOct;             // Glided pitch, log2 Hz, at the end of the current tick
+	float targetOct;            // Target pitch from MIDI note, chord or CV, log2 Hz
+	float tickOct;              // pitchOct plus pitch CV: where phaseIncBase arrives
+	float phaseIncBase;         // Phase increment before timing jitter
+	float phaseIncStep;         // Per-sample multiplier ramping phaseIncBase to tickOct
+	float glideCoeff;           // One-pole glide/portamento coefficient (per sample, in octaves)
+	bool pitchTick;             // Re-tick at the next sample (note on mid-block)
+	bool pitchJump;             // Next tick starts at pitchOct instead of ramping from tickOct
 
 	// Per-formant state
 	float formantDuty[3];       // Duty cycle per formant (ratio of pulse that is active)
+	float formantRatio[3];      // Formant Hz / fundamental Hz (pulsaret cycles per period)
+	float harmRatio[3];         // Harmonic lock: current ratio, gliding toward harmTarget (0 = unset)
+	float harmTarget[3];        // Harmonic lock: nearest whole harmonic of the formant
+	float harmGlideCoeff;       // One-pole glide coefficient between locked harmonics
+	float formantTrackMul;      // Formant Track multiplier at the current pitch (0 = not yet computed)
+	uint8_t formantMip[3];      // Band-limited pulsaret level per formant (0 = full table)
+	float formantAtten[3];      // Formant gain: Nyquist fade × 1/sqrt(duty) overlap normalisation
 	float maskSmooth[3];        // Smoothed mask gain per formant (0=muted, 1=sounding)
 	float maskTarget[3];        // Mask target per formant (updated on pulse boundaries)
 	float maskSmoothCoeff;      // Sample-rate-dependent mask smoothing coefficient (~3ms)
@@ -129,27 +311,78 @@ struct _pulsarVoice {
 	float ampJitter;            // Random amplitude multiplier (0.0–1.0)
 	float phaseIncMult;         // Random timing multiplier (~0.8–1.2)
 
+	// Step sequencer lanes (advanced on each pulse)
+	uint8_t seqPos[kNumLanes];      // Next step to play per lane
+	uint8_t seqDivCount[kNumLanes]; // Clock divider counter per lane
+	float seqValue[kNumLanes];      // Current lane output (scaled, neutral when lane is off)
+	float seqPanL[3];               // Pan gains with pan lane offset applied
+	float seqPanR[3];
+	bool seqPanOn;                  // True when seqPanL/R replace the snapshot pan gains
+
+	// Window/oscillator recurrences for each formant's current pulsaret
+	_pulsaretRotor rot[3];
+	float formantInvDuty[3];        // 1 / formantDuty
+
+	// Live noise pulsaret per formant (Noise Type other than Table):
+	// stream 0 feeds the current pulsaret, stream 1 + t tail t, each
+	// from its own PRNG so overlapping pulsarets don't comb-filter
+	_noiseSource noise[3][kMaxTails + 1];
+	_noiseBand noiseBand[3];
+	uint8_t noisePos;               // Samples since the Band coefficients were updated
+
+	// Overlapping pulsaret tails per formant
+	_pulsaretTail tails[3][kMaxTails];
+	uint8_t activeTails;            // Total live tails across formants (0 skips the tail loops)
+
 	// Parameter snapshot (frozen on release so releasing voices keep their timbre)
 	_voiceSnapshot snap;
 };
 
-// DTC: performance-critical per-sample audio state (~896 bytes)
+// DTC: performance-critical per-sample audio state (~6 KB)
 // Lives in Cortex-M7 tightly-coupled memory for single-cycle access.
-static const int kMaxVoices = 4;
-
 struct _pulsarDTC {
-	_pulsarVoice voices[kMaxVoices]; // 4 voice slots (~416 bytes)
+	_pulsarVoice voices[kMaxVoices]; // 4 voice slots (~1.5 KB each)
 	uint8_t voiceAge[kMaxVoices];    // LRU tracking for voice stealing
 	uint8_t nextVoiceAge;            // Monotonic counter for age assignment
 	bool prevGateHigh;               // Previous gate CV state for edge detection
+	uint8_t polyGates;               // Poly CV gate states, bit v = voice v high
 	int8_t activeVoiceIdx;           // Voice currently tracking pitch CV (-1 if none)
 	float octDownSign;               // Frequency divider toggle: +1 or -1, flips on voice 0 pulse
+	float syncPrev;                  // Last sync bus sample of the previous block
+	uint32_t lockPhase;              // Chord Lock master counter (2^32 = one master period)
+	bool lockActive;                 // Chord Lock was running last block
+	uint8_t lockChord;               // Chord type and voice count it ran with
+	uint8_t lockVoices;
+};
+
+// Period render cache for one voice. A voice whose snapshot, formant
+// ratios, duties and pitch hold still renders a function of master
+// phase alone, so one period of its formant sum is rendered into a
+// phase-indexed table (a slice per block) and read back until anything
+// moves. The key is what the table was rendered from.
+enum { kCacheOff, kCacheFilling, kCachePlaying };
+
+struct _periodCache {
+	_voiceSnapshot snap;            // Key: voice snapshot
+	float ratio[3];                 // Key: formant ratios
+	float duty[3];                  // Key: formant duties
+	float mask[3];                  // Key: smoothed mask gains (settled)
+	float phaseInc;                 // Key: master phase per sample
+	uint32_t gen;                   // Key: parameter generation
+	float invDuty[3];
+	uint8_t mip[3];                 // Band-limited levels and gains derived from the key
+	float atten[3];
+	int size;                       // Table points per period (power of two, >= 2 per sample)
+	int fillPos;                    // Next point to render while filling
+	uint8_t state;                  // kCache*
+	bool played;                    // Voice rotors are stale after playback
+	_pulsaretRotor rot[3][kMaxTails + 1]; // Fill recurrences: current pulsaret and tails per formant
 };
 
 // ============================================================
 // Parameter indices
 //
-// 65 parameters across 16 pages. Indices must match the order
+// 207 parameters across 24 pages. Indices must match the order
 // of entries in the parametersDefault[] array below.
 // ============================================================
 
@@ -157,7 +390,7 @@ enum {
 	// -- Synthesis page --
 	kParamPulsaret,     // 0.0–9.0 (scaling10): morphs between 10 pulsaret waveforms
 	kParamWindow,       // 0.0–4.0 (scaling10): morphs between 5 window functions
-	kParamDutyCycle,    // 1–100%: fraction of pulse period containing active pulsaret
+	kParamDutyCycle,    // 1–400%: fraction of pulse period containing active pulsaret (>100% overlaps)
 	kParamDutyMode,     // Enum: Manual (use Duty Cycle param) or Formant (auto-derive from freq ratio)
 
 	// -- Formants page --
@@ -217,7 +450,7 @@ enum {
 	kParamOutputR,      // Bus selector: right audio output
 	kParamOutputRMode,  // Output mode: 0=add, 1=replace
 
-	kParamGateMode,     // Enum: MIDI / Free Run
+	kParamGateMode,     // Enum: MIDI / Free Run / CV / Poly CV
 	kParamBasePitch,    // MIDI note 0-127, default 69 (A4)
 
 	// -- Polyphony page --
@@ -253,6 +486,97 @@ enum {
 	kParamOctDownR,     // Bus selector: octave-down right output
 	kParamOctDownRMode, // Output mode
 
+	// -- Synthesis page (continued) --
+	kParamLatch,        // Enum: Block / Pulse — when voices pick up parameter changes
+
+	// -- Seq Formant page --
+	kParamSeqFmtLength,  // 0–16: lane length in steps (0 = lane off)
+	kParamSeqFmtDiv,     // 1–16: pulses per step
+	kParamSeqFmtStep1,   // First of kSeqMaxSteps step values
+	kParamSeqFmtStepLast = kParamSeqFmtStep1 + kSeqMaxSteps - 1,
+
+	// -- Seq Duty page --
+	kParamSeqDutyLength,  // 0–16: lane length in steps (0 = lane off)
+	kParamSeqDutyDiv,     // 1–16: pulses per step
+	kParamSeqDutyStep1,   // First of kSeqMaxSteps step values
+	kParamSeqDutyStepLast = kParamSeqDutyStep1 + kSeqMaxSteps - 1,
+
+	// -- Seq Amp page --
+	kParamSeqAmpLength,  // 0–16: lane length in steps (0 = lane off)
+	kParamSeqAmpDiv,     // 1–16: pulses per step
+	kParamSeqAmpStep1,   // First of kSeqMaxSteps step values
+	kParamSeqAmpStepLast = kParamSeqAmpStep1 + kSeqMaxSteps - 1,
+
+	// -- Seq Pan page --
+	kParamSeqPanLength,  // 0–16: lane length in steps (0 = lane off)
+	kParamSeqPanDiv,     // 1–16: pulses per step
+	kParamSeqPanStep1,   // First of kSeqMaxSteps step values
+	kParamSeqPanStepLast = kParamSeqPanStep1 + kSeqMaxSteps - 1,
+
+	// -- Synthesis page (continued) --
+	kParamWindowType,   // Enum: Morph (window bank) or a parametric/sample window
+	kParamWindowShape,  // 0–100%: taper / beta / skew / power for the parametric windows
+	kParamInterp,       // Enum: Linear / Hermite pulsaret table reads
+	kParamPulsaretMorph, // Enum: Crossfade / Spectral (grid) morphing between pulsarets
+	kParamNoiseType,    // Enum: Table / White / Pink / Band noise pulsaret
+	kParamPulsaretY,    // -100–100%: harmonic tilt axis of the 2D pulsaret space (0 = off)
+	kParamPulsaretYCV,  // Bus selector: bipolar ±5V → ±100% Y offset
+
+	// -- Additive page --
+	kParamAdditive,     // Enum: Off / On: pulsaret from the harmonic designer
+	kParamHarmTilt,     // -12.0–12.0 dB/oct tilt applied to the harmonic amplitudes
+	kParamHarmTiltCV,   // Bus selector: bipolar ±5V → ±6 dB/oct tilt offset
+	kParamHarmAmp1,     // First of kAddHarmonics amplitudes (0–100%)
+	kParamHarmAmpLast = kParamHarmAmp1 + kAddHarmonics - 1,
+
+	// -- Add Phase page --
+	kParamHarmPhase1,   // First of kAddHarmonics phases (0–359°)
+	kParamHarmPhaseLast = kParamHarmPhase1 + kAddHarmonics - 1,
+
+	// -- Effects page (continued) --
+	kParamGlissCurve,   // Enum: Exp / Linear / S-Curve glisson sweep
+	kParamGlissF2,      // -100–100%: formant 2 glisson depth relative to Glisson
+	kParamGlissF3,      // -100–100%: formant 3 glisson depth relative to Glisson
+
+	// -- Formants page (continued) --
+	kParamHarmLock,     // Enum: Off/On — snap each formant to the nearest harmonic
+	kParamHarmGlide,    // 0–2000 ms (scaling10): glide time between locked harmonics
+
+	// -- Vowels page --
+	kParamVowelMode,    // Enum: Off/On — formants from the vowel plane instead of Formant Hz
+	kParamVowel,        // 0–40 (scaling10 → 0.0–4.0): A, E, I, O, U
+	kParamVoiceType,    // 0–30 (scaling10 → 0.0–3.0): Bass, Tenor, Alto, Soprano
+	kParamVowelCV,      // Bus selector: bipolar ±5V → ±2.0 vowel offset
+	kParamVoiceTypeCV,  // Bus selector: bipolar ±5V → ±1.5 voice type offset
+
+	// -- Formants page (continued) --
+	kParamFormantCVMode, // Enum: Linear (±1000 Hz) / 1V/Oct formant CV response
+
+	// -- Effects page (continued) --
+	kParamTrackAmount,  // 0–100%: formant tracking slope (octaves of formant per octave of pitch)
+	kParamTrackCentre,  // -48 to +48 semitones from Base Pitch: key where tracking is neutral
+
+	// -- Polyphony page (continued) --
+	kParamTuning,       // Enum: built-in Scala scale for notes and chords
+	kParamTuningRoot,   // MIDI note 0–127: key where scale degree 0 sits (at its 12-TET pitch)
+
+	// -- FM/Sync page --
+	kParamFMInput,      // Bus selector: audio-rate linear through-zero FM of the fundamental
+	kParamFMIndex,      // 0–400%: FM depth per 5V (100% swings the rate between 0 and 2x at ±5V)
+	kParamSyncInput,    // Bus selector: rising zero crossings hard-sync every voice's master phase
+
+	// -- Polyphony page (continued) --
+	kParamVoicePhase,   // Enum: Free / Reset / Stagger — master phase of a starting voice
+	kParamChordLock,    // Enum: Off/On — ratio chords run from one shared phase counter
+
+	// -- CV Voice page (continued) --
+	kParamGate2CV,      // Bus selector: Poly CV voice 2 gate (voice 1 uses Gate CV)
+	kParamPitch2CV,     // Bus selector: Poly CV voice 2 pitch, 1V/oct (voice 1 uses Pitch CV)
+	kParamGate3CV,
+	kParamPitch3CV,
+	kParamGate4CV,
+	kParamPitch4CV,
+
 	kNumParams,
 };
 
@@ -265,7 +589,19 @@ static char const * const enumMaskMode[] = { "Off", "Stochastic", "Burst" };
 static char const * const enumUseSample[] = { "Off", "On" };
 static char const * const enumOnOff[] = { "Off", "On" };
 static char const * const enumFormantTrack[] = { "Fixed", "Track" };
-static char const * const enumGateMode[] = { "MIDI", "Free Run", "CV" };
+static char const * const enumGateMode[] = { "MIDI", "Free Run", "CV", "Poly CV" };
+static char const * const enumLatch[] = { "Block", "Pulse" };
+static char const * const enumWindowType[] = { "Morph", "Tukey", "Kaiser", "Skew", "Power Hann", "Sample" };
+static char const * const enumInterp[] = { "Linear", "Hermite" };
+static char const * const enumPulsaretMorph[] = { "Crossfade", "Spectral" };
+static char const * const enumNoiseType[] = { "Table", "White", "Pink", "Band" };
+static char const * const enumGlissCurve[] = { "Exp", "Linear", "S-Curve" };
+static char const * const enumFormantCVMode[] = { "Linear", "1V/Oct" };
+static char const * const enumVoicePhase[] = { "Free", "Reset", "Stagger" };
+enum { kPhaseFree, kPhaseReset, kPhaseStagger };
+static char const * const enumTuning[] = {
+	"12-TET", "Just", "Pythagorean", "Meantone", "Harmonics", "19-TET", "Bohlen-Pierce"
+};
 static char const * const enumChordType[] = {
 	"Unison", "Octaves", "Fifths", "Sub+Oct",
 	"Major", "Minor", "Maj7", "Min7",
@@ -277,21 +613,31 @@ static char const * const enumChordType[] = {
 // Chord/interval ratio tables for Free Run polyphony
 //
 // Harmonic entries use exact ratios. Tonal chords use equal-
-// temperament semitone ratios: 2^(st/12).
+// temperament semitones. Stored in octaves, added to the log2 pitch.
 // ============================================================
 
 #define ST(n) (1.0f)  // placeholder — filled by initChordRatios()
 
 static const int kNumChordTypes = 14;
-static float chordRatios[kNumChordTypes][kMaxVoices];
+static const int kNumRatioChords = 4;    // Leading chord types built from exact ratios
+
+// Chord Lock: each ratio chord as whole multiples of one master
+// counter (Fifths and Sub+Oct count at half the root). Unison has
+// nothing to lock.
+static const uint8_t kLockMul[kNumRatioChords][kMaxVoices] = {
+	{ 0, 0, 0, 0 },  // Unison (not locked)
+	{ 1, 2, 4, 8 },  // Octaves
+	{ 2, 3, 4, 6 },  // Fifths
+	{ 1, 2, 4, 8 },  // Sub+Oct
+};
+static float chordOctaves[kNumChordTypes][kMaxVoices];
 
-// Called once from construct() to fill the ratio table
+// Called once from construct() to fill the interval table
 static void initChordRatios()
 {
-	// Helper: semitone → frequency ratio
-	// Can't use constexpr with powf, so we compute at init time
+	// Helper: semitone → octaves
 	auto st = [](int semitones) -> float {
-		return powf(2.0f, semitones / 12.0f);
+		return semitones / 12.0f;
 	};
 
 	// Harmonic ratios
@@ -301,9 +647,9 @@ static void initChordRatios()
 		{ 1.0f, 1.5f,   2.0f,   3.0f   },  // 2: Fifths
 		{ 0.5f, 1.0f,   2.0f,   4.0f   },  // 3: Sub+Oct
 	};
-	for (int i = 0; i < 4; ++i)
+	for (int i = 0; i < kNumRatioChords; ++i)
 		for (int v = 0; v < kMaxVoices; ++v)
-			chordRatios[i][v] = table[i][v];
+			chordOctaves[i][v] = log2f(table[i][v]);
 
 	// Tonal chords (semitone intervals from root)
 	int chords[][kMaxVoices] = {
@@ -318,13 +664,236 @@ static void initChordRatios()
 		{ 0, 7, 12, 19 }, // 12: Power
 		{ 0, 7, 12, 16 }, // 13: Open5th
 	};
-	for (int i = 0; i < 10; ++i)
+	for (int i = 0; i < kNumChordTypes - kNumRatioChords; ++i)
 		for (int v = 0; v < kMaxVoices; ++v)
-			chordRatios[4 + i][v] = st(chords[i][v]);
+			chordOctaves[kNumRatioChords + i][v] = st(chords[i][v]);
 }
 
 #undef ST
 
+// ============================================================
+// Tuning tables
+//
+// Scales are Scala (.scl) text: a description line, a degree count,
+// then one pitch per degree — cents if it contains a '.', otherwise a
+// ratio a/b or a whole number. The last degree is the period, so
+// non-octave scales repeat correctly. The plugin API only reads WAV
+// files from the card, so the scales are built in; a new one is just
+// another string. The keyboard mapping is linear (one key per degree)
+// with degree 0 on Tuning Root at its 12-TET pitch.
+//
+// Notes and tonal chords map through a 128-entry note → log2 Hz table
+// rebuilt when the tuning changes, so note-on is a lookup.
+// ============================================================
+
+static const int kMaxScaleDegrees = 64;
+
+static const char* const kScalaScales[] = {
+	"! 12-TET\n12-tone equal temperament\n12\n"
+	"100.0\n200.0\n300.0\n400.0\n500.0\n600.0\n700.0\n800.0\n900.0\n1000.0\n1100.0\n2/1\n",
+	"! Just\n5-limit just intonation\n12\n"
+	"16/15\n9/8\n6/5\n5/4\n4/3\n45/32\n3/2\n8/5\n5/3\n9/5\n15/8\n2/1\n",
+	"! Pythagorean\nPythagorean, Gb to B\n12\n"
+	"256/243\n9/8\n32/27\n81/64\n4/3\n729/512\n3/2\n128/81\n27/16\n16/9\n243/128\n2/1\n",
+	"! Meantone\n1/4-comma meantone, Eb to G#\n12\n"
+	"76.049\n193.157\n310.265\n386.314\n503.422\n579.471\n696.578\n772.627\n889.735\n1006.843\n1082.892\n2/1\n",
+	"! Harmonics\nHarmonics 8 to 16\n8\n"
+	"9/8\n10/8\n11/8\n12/8\n13/8\n14/8\n15/8\n2/1\n",
+	"! 19-TET\n19-tone equal temperament\n19\n"
+	"63.158\n126.316\n189.474\n252.632\n315.789\n378.947\n442.105\n505.263\n568.421\n631.579\n"
+	"694.737\n757.895\n821.053\n884.211\n947.368\n1010.526\n1073.684\n1136.842\n2/1\n",
+	"! Bohlen-Pierce\nJust Bohlen-Pierce, 13 steps of 3/1\n13\n"
+	"27/25\n25/21\n9/7\n7/5\n75/49\n5/3\n9/5\n49/25\n15/7\n7/3\n63/25\n25/9\n3/1\n",
+};
+static const int kNumTunings = ARRAY_SIZE(kScalaScales);
+
+// Whole number at s, advancing s past it.
+static uint32_t scalaInt(const char*& s)
+{
+	uint32_t n = 0;
+	while (*s >= '0' && *s <= '9')
+		n = n * 10 + (uint32_t)(*s++ - '0');
+	return n;
+}
+
+// Parse Scala text into degreeOct[0..count-1] (degrees 1..count in
+// octaves). Returns the degree count, 0 if the text is malformed.
+static int parseScala(const char* s, float* degreeOct, int maxDegrees)
+{
+	int line = 0;       // Non-comment lines seen: description, count, pitches
+	int count = 0;
+	int parsed = 0;
+	while (*s && (line < 2 || parsed < count))
+	{
+		const char* end = s;
+		while (*end && *end != '\n')
+			++end;
+		if (*s != '!')
+		{
+			const char* p = s;
+			while (p < end && (*p == ' ' || *p == '\t'))
+				++p;
+			if (line == 1)
+			{
+				count = (int)scalaInt(p);
+				if (count < 1 || count > maxDegrees)
+					return 0;
+			}
+			else if (line >= 2)
+			{
+				bool negative = (*p == '-');
+				if (negative)
+					++p;
+				float oct;
+				const char* q = p;
+				while (q < end && *q >= '0' && *q <= '9')
+					++q;
+				if (q < end && *q == '.')
+				{
+					// Cents
+					float cents = (float)scalaInt(p);
+					++p;
+					float scale = 0.1f;
+					for (; p < end && *p >= '0' && *p <= '9'; ++p, scale *= 0.1f)
+						cents += (float)(*p - '0') * scale;
+					oct = (negative ? -cents : cents) * (1.0f / 1200.0f);
+				}
+				else
+				{
+					// Ratio a/b or whole number a
+					uint32_t num = scalaInt(p);
+					uint32_t den = 1;
+					if (*p == '/')
+					{
+						++p;
+						den = scalaInt(p);
+					}
+					if (num == 0 || den == 0 || negative)
+						return 0;
+					oct = log2f((float)num / (float)den);
+				}
+				degreeOct[parsed++] = oct;
+			}
+			++line;
+		}
+		s = *end ? end + 1 : end;
+	}
+	return (parsed == count) ? count : 0;
+}
+
+// Fill the note table and the tonal chord steps for one tuning.
+static void buildTuning(float* noteOct, int8_t chordSteps[][kMaxVoices], int tuning, int root)
+{
+	float degreeOct[kMaxScaleDegrees];
+	if (tuning < 0 || tuning >= kNumTunings)
+		tuning = 0;
+	int count = parseScala(kScalaScales[tuning], degreeOct, kMaxScaleDegrees);
+	if (count == 0)
+		count = parseScala(kScalaScales[0], degreeOct, kMaxScaleDegrees);
+	float period = degreeOct[count - 1];
+	float rootOct = kLog2A4 + (root - 69) / 12.0f;
+
+	for (int n = 0; n < 128; ++n)
+	{
+		int d = n - root;
+		int q = (d >= 0) ? d / count : -((-d + count - 1) / count);
+		int r = d - q * count;
+		noteOct[n] = rootOct + q * period + (r > 0 ? degreeOct[r - 1] : 0.0f);
+	}
+
+	// Tonal chords: each 12-TET interval becomes the nearest number of
+	// scale steps, measured up from degree 0
+	for (int c = kNumRatioChords; c < kNumChordTypes; ++c)
+	{
+		for (int v = 0; v < kMaxVoices; ++v)
+		{
+			float target = chordOctaves[c][v];
+			int best = 0;
+			float bestErr = fabsf(target);
+			for (int k = 1; k < 4 * count; ++k)
+			{
+				float oct = (k / count) * period + (k % count > 0 ? degreeOct[k % count - 1] : 0.0f);
+				float err = fabsf(oct - target);
+				if (err < bestErr)
+				{
+					bestErr = err;
+					best = k;
+				}
+			}
+			chordSteps[c][v] = (int8_t)best;
+		}
+	}
+}
+
+
+// ============================================================
+// Glisson sweep curves
+//
+// Exp sweeps 2^(depth·age) and runs as a geometric recurrence. The
+// shaped curves move the multiplier from 1 to 2^(depth·duty) across
+// the pulsaret: Linear in a straight line, S-Curve along a raised
+// cosine read from a small lookup indexed by pulsaret phase.
+// ============================================================
+
+enum { kGlissExp, kGlissLinear, kGlissS };
+static const int kGlissCurveSize = 64;
+static float glissSCurve[kGlissCurveSize + 1];
+
+// Called once from construct() to fill the S-curve lookup
+static void initGlissCurve()
+{
+	for (int i = 0; i <= kGlissCurveSize; ++i)
+		glissSCurve[i] = 0.5f - 0.5f * cosf((float)M_PI * (float)i / (float)kGlissCurveSize);
+}
+
+// ============================================================
+// Vowel formant table
+//
+// F1–F3 in Hz of the sung vowels A, E, I, O, U for four voice types
+// (after the classic Csound formant tables). Vowel × voice type forms
+// a plane that is resolved bilinearly into the formant frequencies once
+// per block.
+// ============================================================
+
+static const int kNumVowels = 5;
+static const int kNumVoiceTypes = 4;
+
+static constexpr float vowelTable[kNumVoiceTypes][kNumVowels][3] = {
+	// A                    E                    I                    O                    U
+	{ { 600, 1040, 2250 }, { 400, 1620, 2400 }, { 250, 1750, 2600 }, { 400,  750, 2400 }, { 350,  600, 2400 } }, // Bass
+	{ { 650, 1080, 2650 }, { 400, 1700, 2600 }, { 290, 1870, 2800 }, { 400,  800, 2600 }, { 350,  600, 2700 } }, // Tenor
+	{ { 800, 1150, 2800 }, { 400, 1600, 2700 }, { 350, 1700, 2700 }, { 450,  800, 2830 }, { 325,  700, 2530 } }, // Alto
+	{ { 800, 1150, 2900 }, { 350, 2000, 2800 }, { 270, 2140, 2950 }, { 450,  800, 2830 }, { 325,  700, 2700 } }, // Soprano
+};
+
+// Highest entry of the first n formants of the table, so the formant
+// ceiling can be checked never to flatten a vowel's F3
+static constexpr float maxOf(float a, float b) { return a > b ? a : b; }
+static constexpr float vowelTableMax(int n)
+{
+	return n <= 0 ? 0.0f
+	     : maxOf(vowelTable[(n - 1) / (3 * kNumVowels)][(n - 1) / 3 % kNumVowels][(n - 1) % 3], vowelTableMax(n - 1));
+}
+static_assert( vowelTableMax(kNumVoiceTypes * kNumVowels * 3) <= kFormantMaxHz, "vowel formants fit under the ceiling" );
+
+// Formant frequencies at a point of the vowel plane. vowel is
+// 0.0–4.0, voiceType 0.0–3.0 (both already clamped).
+static void vowelFormants(float vowel, float voiceType, float hz[3])
+{
+	int x0 = (int)vowel;
+	if (x0 > kNumVowels - 2) x0 = kNumVowels - 2;
+	float fx = vowel - (float)x0;
+	int y0 = (int)voiceType;
+	if (y0 > kNumVoiceTypes - 2) y0 = kNumVoiceTypes - 2;
+	float fy = voiceType - (float)y0;
+	for (int f = 0; f < 3; ++f)
+	{
+		float a = vowelTable[y0][x0][f] + fx * (vowelTable[y0][x0 + 1][f] - vowelTable[y0][x0][f]);
+		float b = vowelTable[y0 + 1][x0][f] + fx * (vowelTable[y0 + 1][x0 + 1][f] - vowelTable[y0 + 1][x0][f]);
+		hz[f] = a + fy * (b - a);
+	}
+}
+
 // ============================================================
 // Parameter definitions
 // ============================================================
@@ -333,14 +902,14 @@ static const _NT_parameter parametersDefault[] = {
 	// Synthesis page
 	{ .name = "Pulsaret",    .min = 0,   .max = 90,    .def = 25,  .unit = kNT_unitNone,    .scaling = kNT_scaling10, .enumStrings = NULL },
 	{ .name = "Window",      .min = 0,   .max = 40,    .def = 5,   .unit = kNT_unitNone,    .scaling = kNT_scaling10, .enumStrings = NULL },
-	{ .name = "Duty Cycle",  .min = 1,   .max = 100,   .def = 50,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Cycle",  .min = 1,   .max = 400,   .def = 50,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
 	{ .name = "Duty Mode",   .min = 0,   .max = 1,     .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumDutyMode },
 
 	// Formants page
 	{ .name = "Formant Count", .min = 1,  .max = 3,    .def = 2,   .unit = kNT_unitNone,    .scaling = kNT_scalingNone, .enumStrings = NULL },
-	{ .name = "Formant 1 Hz",  .min = 20, .max = 2000, .def = 20,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
-	{ .name = "Formant 2 Hz",  .min = 20, .max = 2000, .def = 200, .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
-	{ .name = "Formant 3 Hz",  .min = 20, .max = 2000, .def = 400, .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Formant 1 Hz",  .min = 20, .max = 8000, .def = 20,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Formant 2 Hz",  .min = 20, .max = 8000, .def = 200, .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Formant 3 Hz",  .min = 20, .max = 8000, .def = 400, .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
 
 	// Masking page
 	{ .name = "Mask Mode",   .min = 0,   .max = 2,     .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumMaskMode },
@@ -392,7 +961,7 @@ static const _NT_parameter parametersDefault[] = {
 	NT_PARAMETER_AUDIO_OUTPUT_WITH_MODE( "Output R", 1, 14 )
 
 	// Gate mode (must be at end of routing to match enum order)
-	{ .name = "Gate Mode",   .min = 0,   .max = 2,     .def = 1,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumGateMode },
+	{ .name = "Gate Mode",   .min = 0,   .max = 3,     .def = 1,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumGateMode },
 	{ .name = "Base Pitch",  .min = 0,   .max = 127,   .def = 24,  .unit = kNT_unitMIDINote, .scaling = kNT_scalingNone, .enumStrings = NULL },
 
 	// Polyphony page
@@ -421,44 +990,242 @@ static const _NT_parameter parametersDefault[] = {
 	NT_PARAMETER_AUDIO_OUTPUT_WITH_MODE( "Pre-clip R", 0, 0 )
 	NT_PARAMETER_AUDIO_OUTPUT_WITH_MODE( "Oct Down L", 0, 0 )
 	NT_PARAMETER_AUDIO_OUTPUT_WITH_MODE( "Oct Down R", 0, 0 )
+
+	// Synthesis page (continued)
+	{ .name = "Param Latch",   .min = 0,    .max = 1,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumLatch },
+
+	// Seq Formant page
+	{ .name = "Fmt Length",   .min = 0,    .max = 16,   .def = 0,   .unit = kNT_unitNone,    .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Div",      .min = 1,    .max = 16,   .def = 1,   .unit = kNT_unitNone,    .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 1",   .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 2",   .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 3",   .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 4",   .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 5",   .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 6",   .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 7",   .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 8",   .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 9",   .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 10",  .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 11",  .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 12",  .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 13",  .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 14",  .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 15",  .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Fmt Step 16",  .min = -2000,.max = 2000, .def = 0,  .unit = kNT_unitHz,      .scaling = kNT_scalingNone, .enumStrings = NULL },
+
+	// Seq Duty page
+	{ .name = "Duty Length",  .min = 0,    .max = 16,   .def = 0,   .unit = kNT_unitNone,    .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Div",     .min = 1,    .max = 16,   .def = 1,   .unit = kNT_unitNone,    .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 1",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 2",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 3",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 4",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 5",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 6",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 7",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 8",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 9",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 10", .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 11", .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 12", .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 13", .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 14", .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 15", .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Duty Step 16", .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+
+	// Seq Amp page
+	{ .name = "Amp Length",   .min = 0,    .max = 16,   .def = 0,   .unit = kNT_unitNone,    .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Div",      .min = 1,    .max = 16,   .def = 1,   .unit = kNT_unitNone,    .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 1",   .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 2",   .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 3",   .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 4",   .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 5",   .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 6",   .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 7",   .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 8",   .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 9",   .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 10",  .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 11",  .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 12",  .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 13",  .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 14",  .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 15",  .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Amp Step 16",  .min = 0,    .max = 100,  .def = 100,.unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+
+	// Seq Pan page
+	{ .name = "Pan Length",   .min = 0,    .max = 16,   .def = 0,   .unit = kNT_unitNone,    .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Div",      .min = 1,    .max = 16,   .def = 1,   .unit = kNT_unitNone,    .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 1",   .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 2",   .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 3",   .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 4",   .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 5",   .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 6",   .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 7",   .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 8",   .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 9",   .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 10",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 11",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 12",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 13",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 14",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 15",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Pan Step 16",  .min = -100, .max = 100,  .def = 0,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+
+	// Synthesis page (continued)
+	{ .name = "Window Type",   .min = 0,    .max = 5,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumWindowType },
+	{ .name = "Window Shape",  .min = 0,    .max = 100,  .def = 50,  .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Interpolation", .min = 0,    .max = 1,    .def = kDefaultInterp, .unit = kNT_unitEnum, .scaling = kNT_scalingNone, .enumStrings = enumInterp },
+	{ .name = "Pulsaret Morph", .min = 0,   .max = 1,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumPulsaretMorph },
+	{ .name = "Noise Type",    .min = 0,    .max = 3,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumNoiseType },
+	{ .name = "Pulsaret Y",    .min = -100, .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	NT_PARAMETER_CV_INPUT( "Pulsaret Y CV",  0, 0 )
+
+	// Additive page
+	{ .name = "Additive",      .min = 0,    .max = 1,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumOnOff },
+	{ .name = "Harm Tilt",     .min = -120, .max = 120,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	NT_PARAMETER_CV_INPUT( "Harm Tilt CV",   0, 0 )
+	{ .name = "Harm 1",      .min = 0,    .max = 100,  .def = 100, .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 2",      .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 3",      .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 4",      .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 5",      .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 6",      .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 7",      .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 8",      .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 9",      .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 10",     .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 11",     .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 12",     .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 13",     .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 14",     .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 15",     .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Harm 16",     .min = 0,    .max = 100,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+
+	// Add Phase page
+	{ .name = "Phase 1",     .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 2",     .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 3",     .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 4",     .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 5",     .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 6",     .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 7",     .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 8",     .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 9",     .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 10",    .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 11",    .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 12",    .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 13",    .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 14",    .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 15",    .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Phase 16",    .min = 0,    .max = 359,  .def = 0,   .unit = kNT_unitHasStrings, .scaling = kNT_scalingNone, .enumStrings = NULL },
+
+	// Effects page (continued)
+	{ .name = "Gliss Curve",   .min = 0,    .max = 2,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumGlissCurve },
+	{ .name = "Gliss F2",      .min = -100, .max = 100,  .def = 100, .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Gliss F3",      .min = -100, .max = 100,  .def = 100, .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+
+	// Formants page (continued)
+	{ .name = "Harm Lock",     .min = 0,    .max = 1,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumOnOff },
+	{ .name = "Harm Glide",    .min = 0,    .max = 20000, .def = 0,   .unit = kNT_unitMs,      .scaling = kNT_scaling10,   .enumStrings = NULL },
+
+	// Vowels page
+	{ .name = "Vowel Mode",    .min = 0,    .max = 1,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumOnOff },
+	{ .name = "Vowel",         .min = 0,    .max = 40,   .def = 0,   .unit = kNT_unitNone,    .scaling = kNT_scaling10,   .enumStrings = NULL },
+	{ .name = "Voice Type",    .min = 0,    .max = 30,   .def = 0,   .unit = kNT_unitNone,    .scaling = kNT_scaling10,   .enumStrings = NULL },
+	NT_PARAMETER_CV_INPUT( "Vowel CV",       0, 0 )
+	NT_PARAMETER_CV_INPUT( "Voice Type CV",  0, 0 )
+
+	// Formants page (continued)
+	{ .name = "Formant CV",    .min = 0,    .max = 1,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumFormantCVMode },
+
+	// Effects page (continued)
+	{ .name = "Track Amount",  .min = 0,    .max = 100,  .def = 100, .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	{ .name = "Track Centre",  .min = -48,  .max = 48,   .def = 0,   .unit = kNT_unitSemitones, .scaling = kNT_scalingNone, .enumStrings = NULL },
+
+	// Polyphony page (continued)
+	{ .name = "Tuning",        .min = 0,    .max = 6,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumTuning },
+	{ .name = "Tuning Root",   .min = 0,    .max = 127,  .def = 60,  .unit = kNT_unitMIDINote, .scaling = kNT_scalingNone, .enumStrings = NULL },
+
+	// FM/Sync page
+	NT_PARAMETER_CV_INPUT( "FM Input",       0, 0 )
+	{ .name = "FM Index",      .min = 0,    .max = 400,  .def = 0,   .unit = kNT_unitPercent, .scaling = kNT_scalingNone, .enumStrings = NULL },
+	NT_PARAMETER_CV_INPUT( "Sync Input",     0, 0 )
+
+	// Polyphony page (continued)
+	{ .name = "Voice Phase",   .min = 0,    .max = 2,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumVoicePhase },
+	{ .name = "Chord Lock",    .min = 0,    .max = 1,    .def = 0,   .unit = kNT_unitEnum,    .scaling = kNT_scalingNone, .enumStrings = enumOnOff },
+
+	// CV Voice page (continued)
+	NT_PARAMETER_CV_INPUT( "Gate 2 CV",      0, 0 )
+	NT_PARAMETER_CV_INPUT( "Pitch 2 CV",     0, 0 )
+	NT_PARAMETER_CV_INPUT( "Gate 3 CV",      0, 0 )
+	NT_PARAMETER_CV_INPUT( "Pitch 3 CV",     0, 0 )
+	NT_PARAMETER_CV_INPUT( "Gate 4 CV",      0, 0 )
+	NT_PARAMETER_CV_INPUT( "Pitch 4 CV",     0, 0 )
 };
 
 // ============================================================
 // Parameter pages
 // ============================================================
 
-static const uint8_t pageSynthesis[] = { kParamPulsaret, kParamWindow, kParamDutyCycle, kParamDutyMode };
-static const uint8_t pageFormants[]  = { kParamFormantCount, kParamFormant1Hz, kParamFormant2Hz, kParamFormant3Hz };
+static const uint8_t pageSynthesis[] = { kParamPulsaret, kParamPulsaretY, kParamWindow, kParamWindowType, kParamWindowShape, kParamDutyCycle, kParamDutyMode, kParamLatch, kParamInterp, kParamPulsaretMorph, kParamNoiseType };
+static const uint8_t pageFormants[]  = { kParamFormantCount, kParamFormant1Hz, kParamFormant2Hz, kParamFormant3Hz, kParamFormantCVMode, kParamHarmLock, kParamHarmGlide };
 static const uint8_t pageMasking[]   = { kParamMaskMode, kParamMaskAmount, kParamBurstOn, kParamBurstOff };
 static const uint8_t pageEnvelope[]  = { kParamAttack, kParamRelease, kParamAmplitude, kParamDrive, kParamGlide };
 static const uint8_t pagePanning[]   = { kParamPan1, kParamPan2, kParamPan3 };
-static const uint8_t pagePolyphony[] = { kParamVoiceCount, kParamChordType };
+static const uint8_t pagePolyphony[] = { kParamVoiceCount, kParamChordType, kParamChordLock, kParamVoicePhase, kParamTuning, kParamTuningRoot };
 static const uint8_t pageSample[]    = { kParamUseSample, kParamFolder, kParamFile, kParamSampleRate };
 static const uint8_t pageCV1[]       = { kParamPitchCV, kParamDutyCV, kParamMaskCV };
-static const uint8_t pageCV2[]       = { kParamPulsaretCV, kParamWindowCV, kParamAmplitudeCV };
-static const uint8_t pageCV3[]       = { kParamFormant1CV, kParamFormant2CV, kParamFormant3CV };
+static const uint8_t pageCV2[]       = { kParamPulsaretCV, kParamPulsaretYCV, kParamWindowCV, kParamAmplitudeCV };
+static const uint8_t pageCV3[]       = { kParamFormant1CV, kParamFormant2CV, kParamFormant3CV, kParamVowelCV, kParamVoiceTypeCV };
 static const uint8_t pageCV4[]       = { kParamPan1CV, kParamAttackCV, kParamReleaseCV };
-static const uint8_t pageVoiceCV[]   = { kParamGateCV };
-static const uint8_t pageCV5[]       = { kParamAmpJitterCV, kParamTimingJitterCV, kParamGlissonCV };
-static const uint8_t pageEffects[]   = { kParamAmpJitter, kParamTimingJitter, kParamGlisson, kParamPerFormantMask, kParamFormantTrack };
+static const uint8_t pageVoiceCV[]   = { kParamGateCV, kParamGate2CV, kParamPitch2CV, kParamGate3CV, kParamPitch3CV,
+                                         kParamGate4CV, kParamPitch4CV };
+static const uint8_t pageCV5[]       = { kParamAmpJitterCV, kParamTimingJitterCV, kParamGlissonCV, kParamHarmTiltCV };
+static const uint8_t pageEffects[]   = { kParamAmpJitter, kParamTimingJitter, kParamGlisson, kParamGlissCurve, kParamGlissF2, kParamGlissF3, kParamPerFormantMask, kParamFormantTrack, kParamTrackAmount, kParamTrackCentre };
 static const uint8_t pageAuxOut[]    = { kParamTriggerOut, kParamTriggerOutMode, kParamEnvOut, kParamEnvOutMode, kParamPreClipL, kParamPreClipLMode, kParamPreClipR, kParamPreClipRMode, kParamOctDownL, kParamOctDownLMode, kParamOctDownR, kParamOctDownRMode };
+static const uint8_t pageSeqFmt[]  = { kParamSeqFmtLength, kParamSeqFmtDiv,
+	kParamSeqFmtStep1, kParamSeqFmtStep1 + 1, kParamSeqFmtStep1 + 2, kParamSeqFmtStep1 + 3, kParamSeqFmtStep1 + 4, kParamSeqFmtStep1 + 5, kParamSeqFmtStep1 + 6, kParamSeqFmtStep1 + 7, kParamSeqFmtStep1 + 8, kParamSeqFmtStep1 + 9, kParamSeqFmtStep1 + 10, kParamSeqFmtStep1 + 11, kParamSeqFmtStep1 + 12, kParamSeqFmtStep1 + 13, kParamSeqFmtStep1 + 14, kParamSeqFmtStep1 + 15 };
+static const uint8_t pageSeqDuty[] = { kParamSeqDutyLength, kParamSeqDutyDiv,
+	kParamSeqDutyStep1, kParamSeqDutyStep1 + 1, kParamSeqDutyStep1 + 2, kParamSeqDutyStep1 + 3, kParamSeqDutyStep1 + 4, kParamSeqDutyStep1 + 5, kParamSeqDutyStep1 + 6, kParamSeqDutyStep1 + 7, kParamSeqDutyStep1 + 8, kParamSeqDutyStep1 + 9, kParamSeqDutyStep1 + 10, kParamSeqDutyStep1 + 11, kParamSeqDutyStep1 + 12, kParamSeqDutyStep1 + 13, kParamSeqDutyStep1 + 14, kParamSeqDutyStep1 + 15 };
+static const uint8_t pageSeqAmp[]  = { kParamSeqAmpLength, kParamSeqAmpDiv,
+	kParamSeqAmpStep1, kParamSeqAmpStep1 + 1, kParamSeqAmpStep1 + 2, kParamSeqAmpStep1 + 3, kParamSeqAmpStep1 + 4, kParamSeqAmpStep1 + 5, kParamSeqAmpStep1 + 6, kParamSeqAmpStep1 + 7, kParamSeqAmpStep1 + 8, kParamSeqAmpStep1 + 9, kParamSeqAmpStep1 + 10, kParamSeqAmpStep1 + 11, kParamSeqAmpStep1 + 12, kParamSeqAmpStep1 + 13, kParamSeqAmpStep1 + 14, kParamSeqAmpStep1 + 15 };
+static const uint8_t pageSeqPan[]  = { kParamSeqPanLength, kParamSeqPanDiv,
+	kParamSeqPanStep1, kParamSeqPanStep1 + 1, kParamSeqPanStep1 + 2, kParamSeqPanStep1 + 3, kParamSeqPanStep1 + 4, kParamSeqPanStep1 + 5, kParamSeqPanStep1 + 6, kParamSeqPanStep1 + 7, kParamSeqPanStep1 + 8, kParamSeqPanStep1 + 9, kParamSeqPanStep1 + 10, kParamSeqPanStep1 + 11, kParamSeqPanStep1 + 12, kParamSeqPanStep1 + 13, kParamSeqPanStep1 + 14, kParamSeqPanStep1 + 15 };
+static const uint8_t pageVowels[]    = { kParamVowelMode, kParamVowel, kParamVoiceType };
+static const uint8_t pageAdditive[] = { kParamAdditive, kParamHarmTilt,
+	kParamHarmAmp1, kParamHarmAmp1 + 1, kParamHarmAmp1 + 2, kParamHarmAmp1 + 3, kParamHarmAmp1 + 4, kParamHarmAmp1 + 5, kParamHarmAmp1 + 6, kParamHarmAmp1 + 7, kParamHarmAmp1 + 8, kParamHarmAmp1 + 9, kParamHarmAmp1 + 10, kParamHarmAmp1 + 11, kParamHarmAmp1 + 12, kParamHarmAmp1 + 13, kParamHarmAmp1 + 14, kParamHarmAmp1 + 15 };
+static const uint8_t pageAddPhase[] = {
+	kParamHarmPhase1, kParamHarmPhase1 + 1, kParamHarmPhase1 + 2, kParamHarmPhase1 + 3, kParamHarmPhase1 + 4, kParamHarmPhase1 + 5, kParamHarmPhase1 + 6, kParamHarmPhase1 + 7, kParamHarmPhase1 + 8, kParamHarmPhase1 + 9, kParamHarmPhase1 + 10, kParamHarmPhase1 + 11, kParamHarmPhase1 + 12, kParamHarmPhase1 + 13, kParamHarmPhase1 + 14, kParamHarmPhase1 + 15 };
+static const uint8_t pageFMSync[]    = { kParamFMInput, kParamFMIndex, kParamSyncInput };
 static const uint8_t pageRouting[]   = { kParamOutputL, kParamOutputLMode, kParamOutputR, kParamOutputRMode, kParamGateMode, kParamMidiCh, kParamBasePitch };
 
 static const _NT_parameterPage pages[] = {
 	{ .name = "Synthesis",  .numParams = ARRAY_SIZE(pageSynthesis), .group = 1, .params = pageSynthesis },
 	{ .name = "Formants",   .numParams = ARRAY_SIZE(pageFormants),  .group = 2, .params = pageFormants },
+	{ .name = "Vowels",     .numParams = ARRAY_SIZE(pageVowels),    .group = 2, .params = pageVowels },
 	{ .name = "Masking",    .numParams = ARRAY_SIZE(pageMasking),   .group = 3, .params = pageMasking },
 	{ .name = "Envelope",   .numParams = ARRAY_SIZE(pageEnvelope),  .group = 4, .params = pageEnvelope },
 	{ .name = "Panning",    .numParams = ARRAY_SIZE(pagePanning),   .group = 5, .params = pagePanning },
 	{ .name = "Effects",    .numParams = ARRAY_SIZE(pageEffects),   .group = 8,  .params = pageEffects },
 	{ .name = "Polyphony",  .numParams = ARRAY_SIZE(pagePolyphony), .group = 7, .params = pagePolyphony },
 	{ .name = "Sample",     .numParams = ARRAY_SIZE(pageSample),    .group = 6, .params = pageSample },
+	{ .name = "Additive",   .numParams = ARRAY_SIZE(pageAdditive),  .group = 13, .params = pageAdditive },
+	{ .name = "Add Phase",  .numParams = ARRAY_SIZE(pageAddPhase),  .group = 13, .params = pageAddPhase },
 	{ .name = "CV Inputs",  .numParams = ARRAY_SIZE(pageCV1),       .group = 10, .params = pageCV1 },
 	{ .name = "CV Inputs",  .numParams = ARRAY_SIZE(pageCV2),       .group = 10, .params = pageCV2 },
 	{ .name = "CV Inputs",  .numParams = ARRAY_SIZE(pageCV3),       .group = 10, .params = pageCV3 },
 	{ .name = "CV Inputs",  .numParams = ARRAY_SIZE(pageCV4),       .group = 10, .params = pageCV4 },
 	{ .name = "CV Voice",   .numParams = ARRAY_SIZE(pageVoiceCV),  .group = 10, .params = pageVoiceCV },
 	{ .name = "CV Inputs",  .numParams = ARRAY_SIZE(pageCV5),       .group = 10, .params = pageCV5 },
+	{ .name = "Seq Formant",.numParams = ARRAY_SIZE(pageSeqFmt), .group = 12, .params = pageSeqFmt },
+	{ .name = "Seq Duty",  .numParams = ARRAY_SIZE(pageSeqDuty), .group = 12, .params = pageSeqDuty },
+	{ .name = "Seq Amp",   .numParams = ARRAY_SIZE(pageSeqAmp), .group = 12, .params = pageSeqAmp },
+	{ .name = "Seq Pan",   .numParams = ARRAY_SIZE(pageSeqPan), .group = 12, .params = pageSeqPan },
+	{ .name = "FM/Sync",    .numParams = ARRAY_SIZE(pageFMSync),    .group = 14, .params = pageFMSync },
 	{ .name = "Aux Out",    .numParams = ARRAY_SIZE(pageAuxOut),    .group = 9,  .params = pageAuxOut },
 	{ .name = "Routing",    .numParams = ARRAY_SIZE(pageRouting),   .group = 11, .params = pageRouting },
 };
@@ -489,11 +1256,17 @@ struct _pulsarAlgorithm : public _NT_algorithm
 
 	// Cached parameter values (converted from int16 to float in parameterChanged)
 	float pulsaretIndex;              // 0.0–9.0: pulsaret morph position
+	float pulsaretY;                  // -1.0–1.0: tilt axis of the 2D pulsaret space
 	float windowIndex;                // 0.0–4.0: window morph position
-	float dutyCycle;                  // 0.01–1.0: pulse duty cycle
+	float dutyCycle;                  // 0.01–4.0: pulse duty cycle (>1.0 overlaps pulsarets)
 	int dutyMode;                     // 0=manual, 1=formant-derived
 	int formantCount;                 // 1–3: active formant count
 	float formantHz[3];               // Formant frequencies in Hz
+	int harmLock;                     // 0=off, 1=formants snap to harmonics of the fundamental
+	int vowelMode;                    // 0=off, 1=formants from the vowel plane
+	float vowel;                      // 0.0–4.0: A, E, I, O, U
+	float voiceType;                  // 0.0–3.0: Bass, Tenor, Alto, Soprano
+	float harmGlideMs;                // Glide time between locked harmonics in ms
 	int maskMode;                     // 0=off, 1=stochastic, 2=burst
 	float maskAmount;                 // 0.0–1.0: stochastic mask probability
 	int burstOn;                      // Burst pattern: consecutive sounding pulses
@@ -506,18 +1279,40 @@ struct _pulsarAlgorithm : public _NT_algorithm
 	float pan[3];                     // -1.0 to +1.0: per-formant stereo pan position
 	int useSample;                    // 0=table pulsaret, 1=sample pulsaret
 	float sampleRateRatio;            // 0.25–4.0: sample playback rate multiplier
-	int gateMode;                     // 0=MIDI, 1=Free Run, 2=CV
+	int gateMode;                     // 0=MIDI, 1=Free Run, 2=CV, 3=Poly CV
 	float basePitchHz;                // Hz from Base Pitch param
+	float basePitchOct;               // Base Pitch as log2 Hz
+	float noteOct[128];               // MIDI note → log2 Hz in the current tuning
+	int8_t chordSteps[kNumChordTypes][kMaxVoices]; // Tonal chord intervals in scale steps
 	float peakLevel;                  // Peak |output| over last block (for display)
 	int voiceCount;                   // 1–4: active voice count
 	int chordType;                  // 0–13: chord/interval type for Free Run
+	int voicePhase;                   // kPhaseFree / kPhaseReset / kPhaseStagger
 
 	// Effects cached params
 	float ampJitter;                // 0.0–1.0: per-pulse amplitude jitter amount
 	float timingJitter;             // 0.0–1.0: per-pulse timing jitter amount
 	float glissonDepth;             // ±2.0: pitch sweep depth in octaves
+	int glissCurve;                 // kGliss*: sweep curve
+	float glissScale[3];            // Per-formant depth scale (formant 1 fixed at 1.0)
 	int perFormantMask;             // 0=off, 1=on: independent mask per formant
 	int formantTrack;               // 0=fixed, 1=track: formant Hz tracks pitch
+	float trackAmount;              // 0.0–1.0: tracking slope in octaves per octave
+	int trackCentre;                // Semitones from Base Pitch where tracking is neutral
+	int formantCVMode;              // 0=linear Hz, 1=1V/oct formant CV
+	int latchMode;                  // 0=block, 1=pulse: voices latch params only on new pulse
+	bool hermite;                   // Pulsaret tables read with 4-point Hermite instead of lerp
+
+	// Spectral morph grid: pointers to the original and intermediate
+	// pulsaret tables in morph order (morphSteps per pair, plus the last)
+	bool spectralMorph;             // Pulsaret index reads the grid instead of crossfading
+	int morphSteps;                 // Grid tables per pulsaret pair (specification)
+	const float* morphGrid[kMorphGridMax];
+
+	// Step sequencer lanes (raw step values, scaled by kSeqLaneScale at pulse time)
+	int16_t seqSteps[kNumLanes][kSeqMaxSteps];
+	uint8_t seqLength[kNumLanes];   // 0 = lane off
+	uint8_t seqDiv[kNumLanes];      // Pulses per step
 
 	// Display state (written by step at block rate, read by draw)
 	// Volatile: step() and draw() may run in different interrupt contexts
@@ -535,6 +1330,53 @@ struct _pulsarAlgorithm : public _NT_algorithm
 	bool cardMounted;                 // Tracks SD card mount state for change detection
 	bool awaitingCallback;            // True while an async WAV load is in progress
 	int sampleLoadedFrames;           // Number of valid frames in sampleBuffer
+
+	// Working window table (parametric/sample windows), rebuilt in
+	// kWindowBuildChunk slices per block into the back buffer, then flipped
+	int windowType;                   // 0=morph bank, 1–5 = working table window
+	float windowShape;                // 0.0–1.0 shape control
+	bool windowDirty;                 // Parameters changed since the last build started
+	volatile int windowWorkFront;     // Index of the windowWork table being read
+	int windowBuildPos;               // Next point to render, -1 when idle
+	int windowBuildType;              // Type/shape/frames captured at build start
+	float windowBuildShape;
+	int windowBuildFrames;
+	float windowBuildEnv;             // Sample envelope follower state
+	float windowBuildPeak;            // Largest sample envelope value (for normalisation)
+
+	// Working pulsaret table for the 2D X/Y space, resolved at control
+	// rate in kWindowBuildChunk slices like the working window
+	volatile int pulsaretWorkFront;   // Index of the pulsaretWork table being read
+	bool pulsaretWorkValid;           // A build has completed (front table usable)
+	int pulsaretBuildPos;             // Next point to render, -1 when idle
+	float pulsaretBuildX;             // X/Y captured at build start
+	float pulsaretBuildY;
+	volatile bool displayPulsaretWork;         // draw() previews the working table
+
+	// Additive user pulsaret: harmonic amplitudes/phases rendered into
+	// a double-buffered table in kWindowBuildChunk slices per block
+	bool additive;                    // Pulsaret from the additive table
+	int noiseType;                    // kNoise*: Table keeps the fixed LCG noise table
+	float harmTilt;                   // dB/oct tilt from the parameter
+	float harmAmp[kAddHarmonics];     // 0.0–1.0 per harmonic
+	float harmPhase[kAddHarmonics];   // Radians per harmonic
+	bool additiveDirty;               // Harmonics changed since the last build started
+	volatile int additiveWorkFront;   // Index of the additiveWork table being read
+	bool additiveValid;               // A build has completed (front table usable)
+	int additiveBuildPos;             // Next point to render, -1 when idle
+	float additiveBuildTilt;          // Effective tilt captured at build start
+	float additiveBuildPeak;          // Largest |value| so far (for normalisation)
+	float additiveBuildAmp[kAddHarmonics];   // Tilted amplitudes captured at build start
+	float additiveBuildCos[kAddHarmonics];   // cos/sin of each harmonic's phase
+	float additiveBuildSin[kAddHarmonics];
+	volatile bool displayAdditive;             // draw() previews the additive table
+
+	// Period render cache per voice (tables in DRAM, NULL when the Period
+	// cache specification is off). cacheGen counts parameter changes and
+	// sample loads, so any of them drops every key.
+	_periodCache periodCache[kMaxVoices];
+	_periodCacheTables* periodCacheTables;
+	uint32_t cacheGen;
 };
 
 // ============================================================
@@ -558,7 +1400,7 @@ static float coeffFromMs(float ms, float sr)
 // Table generation
 //
 // Called once in construct() to fill DRAM lookup tables.
-// All tables are 2048 samples, normalized to ±1.0 (pulsarets)
+// All tables are kTableSize samples, normalized to ±1.0 (pulsarets)
 // or 0.0–1.0 (windows). Phase runs 0.0–1.0 across the table.
 // ============================================================
 
@@ -663,92 +1505,605 @@ static void generateWindowTables(float tables[][kTableSize])
 	}
 }
 
-// ============================================================
-// WAV callback — called asynchronously when sample loading completes
-// ============================================================
-
-static void wavCallback(void* callbackData, bool success)
+#ifdef SPALUTER_INTERLEAVED_TABLES
+// Interleaved layout (build with -DSPALUTER_INTERLEAVED_TABLES): entry
+// [k][i] holds point i of tables k and k+1 as value/delta pairs.
+static void buildTablePairs(_tablePair pairs[][kTableSize], const float tables[][kTableSize], int numTables)
 {
-	_pulsarAlgorithm* pThis = static_cast<_pulsarAlgorithm*>(callbackData);
-	pThis->awaitingCallback = false;
-	if (success)
-		pThis->sampleLoadedFrames = pThis->wavRequest.numFrames;
+	for (int k = 0; k < numTables - 1; ++k)
+	{
+		for (int i = 0; i < kTableSize; ++i)
+		{
+			int i2 = (i + 1) & (kTableSize - 1);
+			_tablePair& e = pairs[k][i];
+			e.v0 = tables[k][i];
+			e.d0 = tables[k][i2] - tables[k][i];
+			e.v1 = tables[k + 1][i];
+			e.d1 = tables[k + 1][i2] - tables[k + 1][i];
+		}
+	}
 }
+#endif
 
 // ============================================================
-// calculateRequirements — tell the host how much memory we need
+// Spectral morph grid
+//
+// Crossfading two pulsarets mixes two waveforms. The grid instead
+// holds Morph Steps - 1 intermediate tables per adjacent pair, built
+// once in construct() by interpolating each harmonic's magnitude and
+// phase (shortest arc). A spectral morph is then a grid lookup plus
+// the usual crossfade between two neighbouring grid tables.
 // ============================================================
 
-static_assert( kNumParams == ARRAY_SIZE(parametersDefault) );
+// In-place radix-2 complex FFT, n a power of 2. sign = -1 forward,
+// +1 inverse (unscaled). Construct-time only, so twiddles use sinf/cosf.
+static void fftInPlace(float* re, float* im, int n, float sign)
+{
+	for (int i = 1, j = 0; i < n; ++i)
+	{
+		int bit = n >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j ^= bit;
+		if (i < j)
+		{
+			float t = re[i]; re[i] = re[j]; re[j] = t;
+			t = im[i]; im[i] = im[j]; im[j] = t;
+		}
+	}
+	for (int len = 2; len <= n; len <<= 1)
+	{
+		int half = len >> 1;
+		float ang = sign * 2.0f * (float)M_PI / (float)len;
+		for (int k = 0; k < half; ++k)
+		{
+			float wr = cosf(ang * k);
+			float wi = sinf(ang * k);
+			for (int i = k; i < n; i += len)
+			{
+				int b = i + half;
+				float tr = re[b] * wr - im[b] * wi;
+				float ti = re[b] * wi + im[b] * wr;
+				re[b] = re[i] - tr;
+				im[b] = im[i] - ti;
+				re[i] += tr;
+				im[i] += ti;
+			}
+		}
+	}
+}
 
-void calculateRequirements(_NT_algorithmRequirements& req, const int32_t* specifications)
+// Table → magnitude/phase per bin (0..N/2) in mag/ph.
+static void tableToPolar(const float* table, float* mag, float* ph, float* im)
 {
-	req.numParameters = ARRAY_SIZE(parametersDefault);
-	req.sram = sizeof(_pulsarAlgorithm);
-	req.dram = sizeof(_pulsarDRAM);
-	req.dtc = sizeof(_pulsarDTC);
-	req.itc = 0;
+	for (int i = 0; i < kTableSize; ++i)
+	{
+		mag[i] = table[i];
+		im[i] = 0.0f;
+	}
+	fftInPlace(mag, im, kTableSize, -1.0f);
+	for (int b = 0; b <= kTableSize / 2; ++b)
+	{
+		float re = mag[b];
+		ph[b] = atan2f(im[b], re);
+		mag[b] = sqrtf(re * re + im[b] * im[b]);
+	}
 }
 
-// ============================================================
-// construct — initialize a new plugin instance
-//
-// Called once when the algorithm is loaded into a slot.
-// Sets up memory pointers, generates all lookup tables,
-// initializes DTC state for all 4 voice slots, and configures
-// the WAV request struct for async sample loading.
-// ============================================================
+// Fill grid (steps - 1 tables per pair) and the morph-order pointer
+// list. scratch needs 6 * kTableSize floats.
+static void buildMorphGrid(const float* grid[], float* gridTables, int steps,
+                           const float tables[][kTableSize], float* scratch)
+{
+	float* magA = scratch;
+	float* phA = scratch + kTableSize;
+	float* magB = scratch + 2 * kTableSize;
+	float* phB = scratch + 3 * kTableSize;
+	float* re = scratch + 4 * kTableSize;
+	float* im = scratch + 5 * kTableSize;
+	const float invN = 1.0f / (float)kTableSize;
+
+	for (int k = 0; k < kNumPulsarets - 1; ++k)
+	{
+		grid[k * steps] = tables[k];
+		if (steps < 2)
+			continue;
 
-_NT_algorithm* construct(const _NT_algorithmMemoryPtrs& ptrs, const _NT_algorithmRequirements& req, const int32_t* specifications)
+		tableToPolar(tables[k], magA, phA, re);
+		tableToPolar(tables[k + 1], magB, phB, re);
+
+		for (int st = 1; st < steps; ++st)
+		{
+			float t = (float)st / (float)steps;
+			for (int b = 0; b <= kTableSize / 2; ++b)
+			{
+				// DC and Nyquist are real: a signed lerp, not a phase arc
+				if (b == 0 || b == kTableSize / 2)
+				{
+					float a = magA[b] * cosf(phA[b]);
+					re[b] = a + t * (magB[b] * cosf(phB[b]) - a);
+					im[b] = 0.0f;
+					continue;
+				}
+				float mag = magA[b] + t * (magB[b] - magA[b]);
+				float ph;
+				if (magA[b] < 1e-6f)
+					ph = phB[b];
+				else if (magB[b] < 1e-6f)
+					ph = phA[b];
+				else
+				{
+					float d = phB[b] - phA[b];
+					if (d > (float)M_PI) d -= 2.0f * (float)M_PI;
+					if (d < -(float)M_PI) d += 2.0f * (float)M_PI;
+					ph = phA[b] + t * d;
+				}
+				re[b] = mag * cosf(ph);
+				im[b] = mag * sinf(ph);
+			}
+			// Conjugate-symmetric upper half → real table
+			for (int b = 1; b < kTableSize / 2; ++b)
+			{
+				re[kTableSize - b] = re[b];
+				im[kTableSize - b] = -im[b];
+			}
+			fftInPlace(re, im, kTableSize, 1.0f);
+
+			float* dst = gridTables + (k * (steps - 1) + st - 1) * kTableSize;
+			for (int i = 0; i < kTableSize; ++i)
+				dst[i] = re[i] * invN;
+			grid[k * steps + st] = dst;
+		}
+	}
+	grid[(kNumPulsarets - 1) * steps] = tables[kNumPulsarets - 1];
+}
+
+// Y axis of the 2D pulsaret space: each pulsaret with its harmonic
+// n scaled by 1/n (row 0, dark) or by n (row 1, bright), renormalised
+// to a ±1 peak. scratch needs 2 * kTableSize floats.
+static void buildTiltRows(float rows[][kNumPulsarets][kTableSize], const float tables[][kTableSize], float* scratch)
 {
-	_pulsarAlgorithm* alg = new (ptrs.sram) _pulsarAlgorithm();
+	float* re = scratch;
+	float* im = scratch + kTableSize;
+	for (int row = 0; row < 2; ++row)
+	{
+		for (int k = 0; k < kNumPulsarets; ++k)
+		{
+			for (int i = 0; i < kTableSize; ++i)
+			{
+				re[i] = tables[k][i];
+				im[i] = 0.0f;
+			}
+			fftInPlace(re, im, kTableSize, -1.0f);
+			for (int b = 1; b < kTableSize; ++b)
+			{
+				int n = (b <= kTableSize / 2) ? b : kTableSize - b;
+				float g = (row == 0) ? 1.0f / (float)n : (float)n;
+				re[b] *= g;
+				im[b] *= g;
+			}
+			fftInPlace(re, im, kTableSize, 1.0f);
+
+			float peak = 0.0f;
+			for (int i = 0; i < kTableSize; ++i)
+				if (fabsf(re[i]) > peak) peak = fabsf(re[i]);
+			float norm = (peak > 0.0f) ? 1.0f / peak : 0.0f;
+			for (int i = 0; i < kTableSize; ++i)
+				rows[row][k][i] = re[i] * norm;
+		}
+	}
+}
 
-	alg->dtc = reinterpret_cast<_pulsarDTC*>(ptrs.dtc);
-	alg->dram = reinterpret_cast<_pulsarDRAM*>(ptrs.dram);
+// Band-limited levels of every pulsaret: each level keeps the lowest
+// mipHarmonics(L) harmonics, then is decimated to four points per
+// kept harmonic (kMipMinSize at least). scratch needs 2 * kTableSize
+// floats.
+static void buildPulsaretMips(float mips[][kMipTotal], const float tables[][kTableSize], float* scratch)
+{
+	float* re = scratch;
+	float* im = scratch + kTableSize;
+	for (int k = 0; k < kNumPulsarets; ++k)
+	{
+		for (int level = 1; level <= kMipLevels; ++level)
+		{
+			int size = mipSize(level);
+			int harmonics = mipHarmonics(level);
+			for (int i = 0; i < kTableSize; ++i)
+			{
+				re[i] = tables[k][i];
+				im[i] = 0.0f;
+			}
+			fftInPlace(re, im, kTableSize, -1.0f);
+			for (int b = harmonics + 1; b < kTableSize - harmonics; ++b)
+				re[b] = im[b] = 0.0f;
+			fftInPlace(re, im, kTableSize, 1.0f);
+
+			float* dst = mips[k] + mipOffset(level);
+			int stride = kTableSize / size;
+			float norm = 1.0f / (float)kTableSize;
+			for (int i = 0; i < size; ++i)
+				dst[i] = re[i * stride] * norm;
+		}
+	}
+}
 
-	// Copy mutable parameters
-	memcpy(alg->params, parametersDefault, sizeof(parametersDefault));
-	alg->parameters = alg->params;
-	alg->parameterPages = &parameterPages;
+// Parametric windows for the working table (x runs 0.0–1.0, shape 0.0–1.0):
+//   1: tukey       — flat top with cosine tapers, shape = taper fraction (0 = rect, 1 = hann)
+//   2: kaiser      — I0(beta*sqrt(1-(2x-1)^2)) / I0(beta), shape → beta 0–20
+//   3: skew        — raised-cosine attack to a peak at x = shape, raised-cosine decay after
+//   4: power hann  — hann^n, shape → n = 0.25–8 (exponential)
+// Type 5 (sample envelope) is built by buildWindowChunk() from the sample buffer.
 
-	// Initialize DTC (memset zeros all fields including all 4 voices)
-	_pulsarDTC* dtc = alg->dtc;
-	memset(dtc, 0, sizeof(_pulsarDTC));
-	dtc->prevGateHigh = false;
-	dtc->activeVoiceIdx = -1;
-	dtc->octDownSign = 1.0f;
+// Modified Bessel function I0 (power series, converges quickly for x ≤ 20)
+static float besselI0(float x)
+{
+	float sum = 1.0f;
+	float term = 1.0f;
+	float q = 0.25f * x * x;
+	for (int k = 1; k < 40; ++k)
+	{
+		term *= q / (float)(k * k);
+		sum += term;
+		if (term < sum * 1e-7f) break;
+	}
+	return sum;
+}
 
-	float sr = static_cast<float>(NT_globals.sampleRate);
-	float dcCoeff = 1.0f - (2.0f * static_cast<float>(M_PI) * 25.0f / sr);
-	float maskCoeff = coeffFromMs(3.0f, sr);
+static float parametricWindow(int type, float shape, float x)
+{
+	switch (type)
+	{
+	case 1: // tukey
+	{
+		float a = shape;
+		if (a < 0.001f) return 1.0f;
+		float edge = 0.5f * a;
+		if (x < edge) return 0.5f * (1.0f - cosf((float)M_PI * x / edge));
+		if (x > 1.0f - edge) return 0.5f * (1.0f - cosf((float)M_PI * (1.0f - x) / edge));
+		return 1.0f;
+	}
+	case 2: // kaiser
+	{
+		float beta = shape * 20.0f;
+		float t = 2.0f * x - 1.0f;
+		float r = 1.0f - t * t;
+		return besselI0(beta * sqrtf(r > 0.0f ? r : 0.0f)) / besselI0(beta);
+	}
+	case 3: // skew
+	{
+		float peak = 0.01f + 0.98f * shape;
+		if (x < peak) return 0.5f * (1.0f - cosf((float)M_PI * x / peak));
+		return 0.5f * (1.0f + cosf((float)M_PI * (x - peak) / (1.0f - peak)));
+	}
+	case 4: // power hann
+	{
+		float h = 0.5f * (1.0f - cosf(2.0f * (float)M_PI * x));
+		float n = exp2f(shape * 5.0f - 2.0f);
+		return (h > 0.0f) ? powf(h, n) : 0.0f;
+	}
+	}
+	return 0.5f * (1.0f - cosf(2.0f * (float)M_PI * x));
+}
 
+// True while a sounding voice's snapshot still reads buffer buf of a
+// working table. A rebuild waits until no voice has the back buffer
+// latched: mid-pulsaret and frozen (released) voices keep their table
+// and pick up the new front when they next latch.
+static bool workBufferLatched(const _pulsarAlgorithm* pThis, int table, int buf)
+{
 	for (int v = 0; v < kMaxVoices; ++v)
 	{
-		_pulsarVoice& voice = dtc->voices[v];
-		voice.attackCoeff = 0.99f;
-		voice.releaseCoeff = 0.999f;
-		voice.prngState = 48271u + v * 12345u;
-		voice.leakDC_coeff = dcCoeff;
-		voice.maskSmoothCoeff = maskCoeff;
-		voice.ampJitter = 1.0f;
-		voice.phaseIncMult = 1.0f;
-		for (int i = 0; i < 3; ++i)
+		const _pulsarVoice& voice = pThis->dtc->voices[v];
+		if ((voice.gate || voice.envValue >= 0.0001f) && voice.snap.workFront[table] == buf)
+			return true;
+	}
+	return false;
+}
+
+// Render the next slice of the working window table into the back
+// buffer and flip it to the front once complete. Called once per
+// block from step() so a rebuild is spread over several blocks;
+// voices move to the new front when they next latch.
+static void buildWindowChunk(_pulsarAlgorithm* pThis)
+{
+	if (pThis->windowBuildPos < 0)
+	{
+		if (!pThis->windowDirty || pThis->windowType == 0)
+			return;
+		if (workBufferLatched(pThis, kWorkWindow, pThis->windowWorkFront ^ 1))
+			return;
+		pThis->windowDirty = false;
+		pThis->windowBuildPos = 0;
+		pThis->windowBuildType = pThis->windowType;
+		pThis->windowBuildShape = pThis->windowShape;
+		pThis->windowBuildFrames = pThis->sampleLoadedFrames;
+		pThis->windowBuildEnv = 0.0f;
+		pThis->windowBuildPeak = 0.0f;
+	}
+
+	float* dst = pThis->dram->windowWork[pThis->windowWorkFront ^ 1];
+	int type = pThis->windowBuildType;
+	int frames = pThis->windowBuildFrames;
+	bool fromSample = (type == 5 && frames >= 2);
+	int start = pThis->windowBuildPos;
+	int end = start + kWindowBuildChunk;
+	if (end > kTableSize) end = kTableSize;
+
+	if (fromSample)
+	{
+		// Sample envelope: peak of each table segment through a
+		// fast-attack, slow-release follower
+		const float* smp = pThis->dram->sampleBuffer;
+		float env = pThis->windowBuildEnv;
+		float peak = pThis->windowBuildPeak;
+		for (int i = start; i < end; ++i)
 		{
-			voice.formantDuty[i] = 0.5f;
-			voice.maskSmooth[i] = 1.0f;
-			voice.maskTarget[i] = 1.0f;
+			int s0 = (int)((int64_t)i * frames / kTableSize);
+			int s1 = (int)((int64_t)(i + 1) * frames / kTableSize);
+			if (s1 <= s0) s1 = s0 + 1;
+			float pk = 0.0f;
+			for (int n = s0; n < s1; ++n)
+			{
+				float a = fabsf(smp[n]);
+				if (a > pk) pk = a;
+			}
+			env = (pk > env) ? pk : pk + 0.9f * (env - pk);
+			dst[i] = env;
+			if (env > peak) peak = env;
 		}
+		pThis->windowBuildEnv = env;
+		pThis->windowBuildPeak = peak;
+	}
+	else
+	{
+		for (int i = start; i < end; ++i)
+			dst[i] = parametricWindow(type, pThis->windowBuildShape, (float)i / (float)(kTableSize - 1));
 	}
 
-	// Initialize algorithm cached values (placement new does NOT zero members)
-	alg->pulsaretIndex = 2.5f;
-	alg->windowIndex = 0.5f;
-	alg->dutyCycle = 0.5f;
-	alg->dutyMode = 0;
-	alg->formantCount = 2;
+	if (end < kTableSize)
+	{
+		pThis->windowBuildPos = end;
+		return;
+	}
+
+	// Complete: normalise the sample envelope to a 1.0 peak, then flip
+	if (fromSample && pThis->windowBuildPeak > 0.0f)
+	{
+		float norm = 1.0f / pThis->windowBuildPeak;
+		for (int i = 0; i < kTableSize; ++i)
+			dst[i] *= norm;
+	}
+	pThis->windowWorkFront = pThis->windowWorkFront ^ 1;
+	pThis->windowBuildPos = -1;
+}
+
+// Resolve the 2D pulsaret space at (x, y) into the working table: a
+// bilinear blend of four tables (two X neighbours in the original row
+// and in the dark or bright tilt row), one slice per block. Voices
+// keep reading the table they latched until they latch again.
+static void buildPulsaretChunk(_pulsarAlgorithm* pThis, float x, float y)
+{
+	if (pThis->pulsaretBuildPos < 0)
+	{
+		if (y == 0.0f)
+			return;
+		if (pThis->pulsaretWorkValid && x == pThis->pulsaretBuildX && y == pThis->pulsaretBuildY)
+			return;
+		if (workBufferLatched(pThis, kWorkPulsaret, pThis->pulsaretWorkFront ^ 1))
+			return;
+		pThis->pulsaretBuildPos = 0;
+		pThis->pulsaretBuildX = x;
+		pThis->pulsaretBuildY = y;
+	}
+
+	const _pulsarDRAM* dram = pThis->dram;
+	float bx = pThis->pulsaretBuildX;
+	float by = pThis->pulsaretBuildY;
+	int x0 = (int)bx;
+	float fx = bx - x0;
+	if (x0 >= kNumPulsarets - 1) { x0 = kNumPulsarets - 2; fx = 1.0f; }
+	const float (*rowA)[kTableSize] = dram->pulsaretTables;
+	const float (*rowB)[kTableSize] = dram->pulsaretTilt[by < 0.0f ? 0 : 1];
+	float fy = fabsf(by);
+
+	float* dst = pThis->dram->pulsaretWork[pThis->pulsaretWorkFront ^ 1];
+	int start = pThis->pulsaretBuildPos;
+	int end = start + kWindowBuildChunk;
+	if (end > kTableSize) end = kTableSize;
+	for (int i = start; i < end; ++i)
+	{
+		float a = rowA[x0][i] + fx * (rowA[x0 + 1][i] - rowA[x0][i]);
+		float b = rowB[x0][i] + fx * (rowB[x0 + 1][i] - rowB[x0][i]);
+		dst[i] = a + fy * (b - a);
+	}
+
+	if (end < kTableSize)
+	{
+		pThis->pulsaretBuildPos = end;
+		return;
+	}
+	pThis->pulsaretWorkFront = pThis->pulsaretWorkFront ^ 1;
+	pThis->pulsaretWorkValid = true;
+	pThis->pulsaretBuildPos = -1;
+}
+
+// Render the additive user pulsaret: sum of kAddHarmonics sines with
+// the captured amplitudes (tilt applied) and phases. Harmonic n at
+// point i comes from the n-th power of the point's unit rotation, so a
+// slice costs one sinf/cosf pair per point. The result is normalised
+// to a ±1 peak before the flip.
+static void buildAdditiveChunk(_pulsarAlgorithm* pThis, float tilt)
+{
+	if (pThis->additiveBuildPos < 0)
+	{
+		if (!pThis->additive)
+			return;
+		if (!pThis->additiveDirty && pThis->additiveValid && fabsf(tilt - pThis->additiveBuildTilt) < 0.05f)
+			return;
+		if (workBufferLatched(pThis, kWorkAdditive, pThis->additiveWorkFront ^ 1))
+			return;
+		pThis->additiveDirty = false;
+		pThis->additiveBuildPos = 0;
+		pThis->additiveBuildTilt = tilt;
+		pThis->additiveBuildPeak = 0.0f;
+		// dB/oct → gain n^(tilt / 6.02)
+		float tiltExp = tilt * (1.0f / 6.0206f);
+		for (int n = 0; n < kAddHarmonics; ++n)
+		{
+			pThis->additiveBuildAmp[n] = pThis->harmAmp[n] * powf((float)(n + 1), tiltExp);
+			pThis->additiveBuildCos[n] = cosf(pThis->harmPhase[n]);
+			pThis->additiveBuildSin[n] = sinf(pThis->harmPhase[n]);
+		}
+	}
+
+	float* dst = pThis->dram->additiveWork[pThis->additiveWorkFront ^ 1];
+	int start = pThis->additiveBuildPos;
+	int end = start + kWindowBuildChunk;
+	if (end > kTableSize) end = kTableSize;
+	float peak = pThis->additiveBuildPeak;
+	for (int i = start; i < end; ++i)
+	{
+		float theta = 2.0f * (float)M_PI * (float)i / (float)kTableSize;
+		float c1 = cosf(theta);
+		float s1 = sinf(theta);
+		float cn = c1;
+		float sn = s1;
+		float sum = 0.0f;
+		for (int n = 0; n < kAddHarmonics; ++n)
+		{
+			// sin(nθ + φ) = sin nθ cos φ + cos nθ sin φ
+			sum += pThis->additiveBuildAmp[n] * (sn * pThis->additiveBuildCos[n] + cn * pThis->additiveBuildSin[n]);
+			float c = cn * c1 - sn * s1;
+			sn = sn * c1 + cn * s1;
+			cn = c;
+		}
+		dst[i] = sum;
+		if (fabsf(sum) > peak) peak = fabsf(sum);
+	}
+	pThis->additiveBuildPeak = peak;
+
+	if (end < kTableSize)
+	{
+		pThis->additiveBuildPos = end;
+		return;
+	}
+
+	float norm = (peak > 0.0f) ? 1.0f / peak : 0.0f;
+	for (int i = 0; i < kTableSize; ++i)
+		dst[i] *= norm;
+	pThis->additiveWorkFront = pThis->additiveWorkFront ^ 1;
+	pThis->additiveValid = true;
+	pThis->additiveBuildPos = -1;
+}
+
+// ============================================================
+// WAV callback — called asynchronously when sample loading completes
+// ============================================================
+
+static void wavCallback(void* callbackData, bool success)
+{
+	_pulsarAlgorithm* pThis = static_cast<_pulsarAlgorithm*>(callbackData);
+	pThis->awaitingCallback = false;
+	++pThis->cacheGen;
+	if (success)
+	{
+		pThis->sampleLoadedFrames = pThis->wavRequest.numFrames;
+		if (pThis->windowType == 5)
+			pThis->windowDirty = true;
+	}
+}
+
+// ============================================================
+// calculateRequirements — tell the host how much memory we need
+// ============================================================
+
+static_assert( kNumParams == ARRAY_SIZE(parametersDefault) );
+static_assert( kSampleBufferSize >= 6 * kTableSize, "morph grid FFT scratch" );
+static_assert( mipHarmonics(kMipLevels) == 1, "smallest mip level is the fundamental alone" );
+static_assert( mipOffset(kMipLevels) + mipSize(kMipLevels) <= kMipTotal, "last mip level fits its row" );
+
+void calculateRequirements(_NT_algorithmRequirements& req, const int32_t* specifications)
+{
+	req.numParameters = ARRAY_SIZE(parametersDefault);
+	req.sram = sizeof(_pulsarAlgorithm);
+	int morphSteps = specifications ? specifications[0] : kMorphStepsDefault;
+	bool periodCacheOn = specifications ? specifications[1] != 0 : true;
+	req.dram = sizeof(_pulsarDRAM) + (kNumPulsarets - 1) * (morphSteps - 1) * kTableSize * sizeof(float)
+	         + (periodCacheOn ? sizeof(_periodCacheTables) : 0);
+	req.dtc = sizeof(_pulsarDTC);
+	req.itc = 0;
+}
+
+// ============================================================
+// construct — initialize a new plugin instance
+//
+// Called once when the algorithm is loaded into a slot.
+// Sets up memory pointers, generates all lookup tables,
+// initializes DTC state for all 4 voice slots, and configures
+// the WAV request struct for async sample loading.
+// ============================================================
+
+_NT_algorithm* construct(const _NT_algorithmMemoryPtrs& ptrs, const _NT_algorithmRequirements& req, const int32_t* specifications)
+{
+	_pulsarAlgorithm* alg = new (ptrs.sram) _pulsarAlgorithm();
+
+	alg->dtc = reinterpret_cast<_pulsarDTC*>(ptrs.dtc);
+	alg->dram = reinterpret_cast<_pulsarDRAM*>(ptrs.dram);
+
+	// Copy mutable parameters
+	memcpy(alg->params, parametersDefault, sizeof(parametersDefault));
+	alg->parameters = alg->params;
+	alg->parameterPages = &parameterPages;
+
+	// Initialize DTC (memset zeros all fields including all 4 voices)
+	_pulsarDTC* dtc = alg->dtc;
+	memset(dtc, 0, sizeof(_pulsarDTC));
+	dtc->prevGateHigh = false;
+	dtc->activeVoiceIdx = -1;
+	dtc->octDownSign = 1.0f;
+
+	float sr = static_cast<float>(NT_globals.sampleRate);
+	float dcCoeff = 1.0f - (2.0f * static_cast<float>(M_PI) * 25.0f / sr);
+	float maskCoeff = coeffFromMs(3.0f, sr);
+
+	for (int v = 0; v < kMaxVoices; ++v)
+	{
+		_pulsarVoice& voice = dtc->voices[v];
+		voice.attackCoeff = 0.99f;
+		voice.releaseCoeff = 0.999f;
+		voice.prngState = 48271u + v * 12345u;
+		voice.leakDC_coeff = dcCoeff;
+		voice.maskSmoothCoeff = maskCoeff;
+		voice.ampJitter = 1.0f;
+		voice.phaseIncMult = 1.0f;
+		voice.seqValue[kLaneAmp] = 1.0f;
+		voice.noisePos = kNoiseBlock;
+		for (int f = 0; f < 3; ++f)
+			for (int k = 0; k <= kMaxTails; ++k)
+				voice.noise[f][k].seed = 0x9E3779B9u * (uint32_t)((v * 3 + f) * (kMaxTails + 1) + k + 1);
+		for (int i = 0; i < 3; ++i)
+		{
+			voice.formantDuty[i] = 0.5f;
+			voice.formantAtten[i] = 1.0f;
+			voice.maskSmooth[i] = 1.0f;
+			voice.maskTarget[i] = 1.0f;
+		}
+	}
+
+	// Initialize algorithm cached values (placement new does NOT zero members)
+	alg->pulsaretIndex = 2.5f;
+	alg->windowIndex = 0.5f;
+	alg->dutyCycle = 0.5f;
+	alg->dutyMode = 0;
+	alg->formantCount = 2;
 	alg->formantHz[0] = 20.0f;
 	alg->formantHz[1] = 200.0f;
 	alg->formantHz[2] = 400.0f;
+	alg->harmLock = 0;
+	alg->vowelMode = 0;
+	alg->vowel = 0.0f;
+	alg->voiceType = 0.0f;
+	alg->harmGlideMs = 0.0f;
 	alg->maskMode = 0;
 	alg->maskAmount = 0.5f;
 	alg->burstOn = 4;
@@ -764,15 +2119,32 @@ _NT_algorithm* construct(const _NT_algorithmMemoryPtrs& ptrs, const _NT_algorith
 	alg->useSample = 0;
 	alg->sampleRateRatio = 1.0f;
 	alg->gateMode = 1;
-	alg->basePitchHz = 440.0f * exp2f((24 - 69) / 12.0f);
 	alg->peakLevel = 0.0f;
 	alg->voiceCount = 1;
 	alg->chordType = 0;
+	alg->voicePhase = kPhaseFree;
 	alg->ampJitter = 0.0f;
 	alg->timingJitter = 0.0f;
 	alg->glissonDepth = 0.0f;
+	alg->glissCurve = kGlissExp;
+	alg->glissScale[0] = alg->glissScale[1] = alg->glissScale[2] = 1.0f;
 	alg->perFormantMask = 0;
 	alg->formantTrack = 0;
+	alg->trackAmount = 1.0f;
+	alg->trackCentre = 0;
+	alg->formantCVMode = 0;
+	alg->latchMode = 0;
+	alg->hermite = (kDefaultInterp == 1);
+	alg->spectralMorph = false;
+	memset(alg->periodCache, 0, sizeof(alg->periodCache));
+	alg->cacheGen = 0;
+	for (int lane = 0; lane < kNumLanes; ++lane)
+	{
+		alg->seqLength[lane] = 0;
+		alg->seqDiv[lane] = 1;
+		for (int k = 0; k < kSeqMaxSteps; ++k)
+			alg->seqSteps[lane][k] = (lane == kLaneAmp) ? 100 : 0;
+	}
 	alg->displayPulsaretIdx = 2.5f;
 	alg->displayWindowIdx = 0.5f;
 	alg->displayDuty = 0.5f;
@@ -786,6 +2158,28 @@ _NT_algorithm* construct(const _NT_algorithmMemoryPtrs& ptrs, const _NT_algorith
 	alg->cardMounted = false;
 	alg->awaitingCallback = false;
 	alg->sampleLoadedFrames = 0;
+	alg->windowType = 0;
+	alg->windowShape = 0.5f;
+	alg->windowDirty = false;
+	alg->windowWorkFront = 0;
+	alg->windowBuildPos = -1;
+	alg->pulsaretY = 0.0f;
+	alg->pulsaretWorkFront = 0;
+	alg->pulsaretWorkValid = false;
+	alg->pulsaretBuildPos = -1;
+	alg->additive = false;
+	alg->noiseType = kNoiseTable;
+	alg->harmTilt = 0.0f;
+	for (int n = 0; n < kAddHarmonics; ++n)
+	{
+		alg->harmAmp[n] = (n == 0) ? 1.0f : 0.0f;
+		alg->harmPhase[n] = 0.0f;
+	}
+	alg->additiveDirty = true;
+	alg->additiveWorkFront = 0;
+	alg->additiveValid = false;
+	alg->additiveBuildPos = -1;
+	alg->windowBuildFrames = 0;
 
 	// Setup WAV request
 	alg->wavRequest.callback = wavCallback;
@@ -797,10 +2191,33 @@ _NT_algorithm* construct(const _NT_algorithmMemoryPtrs& ptrs, const _NT_algorith
 	alg->wavRequest.startOffset = 0;
 	alg->wavRequest.dst = alg->dram->sampleBuffer;
 
-	// Generate lookup tables, chord ratios, and clear sample buffer
+	// Generate lookup tables, chord ratios, tuning, and clear sample buffer
 	initChordRatios();
+	buildTuning(alg->noteOct, alg->chordSteps, 0, 60);
+	alg->basePitchOct = alg->noteOct[24];
+	alg->basePitchHz = exp2f(alg->basePitchOct);
+	initGlissCurve();
 	generatePulsaretTables(alg->dram->pulsaretTables);
 	generateWindowTables(alg->dram->windowTables);
+#ifdef SPALUTER_INTERLEAVED_TABLES
+	buildTablePairs(alg->dram->pulsaretPairs, alg->dram->pulsaretTables, kNumPulsarets);
+	buildTablePairs(alg->dram->windowPairs, alg->dram->windowTables, kNumWindows);
+#endif
+
+	// Spectral morph grid lives after _pulsarDRAM; the (still empty)
+	// sample buffer serves as FFT scratch
+	alg->morphSteps = specifications ? specifications[0] : kMorphStepsDefault;
+	float* gridTables = reinterpret_cast<float*>(alg->dram + 1);
+	buildMorphGrid(alg->morphGrid, gridTables, alg->morphSteps,
+	               alg->dram->pulsaretTables, alg->dram->sampleBuffer);
+	bool periodCacheOn = specifications ? specifications[1] != 0 : true;
+	alg->periodCacheTables = periodCacheOn
+		? reinterpret_cast<_periodCacheTables*>(gridTables + (kNumPulsarets - 1) * (alg->morphSteps - 1) * kTableSize)
+		: NULL;
+	buildTiltRows(alg->dram->pulsaretTilt, alg->dram->pulsaretTables, alg->dram->sampleBuffer);
+	buildPulsaretMips(alg->dram->pulsaretMips, alg->dram->pulsaretTables, alg->dram->sampleBuffer);
+	memcpy(alg->dram->windowWork[0], alg->dram->windowTables[2], sizeof(alg->dram->windowWork[0]));
+	memcpy(alg->dram->windowWork[1], alg->dram->windowTables[2], sizeof(alg->dram->windowWork[1]));
 	memset(alg->dram->sampleBuffer, 0, sizeof(alg->dram->sampleBuffer));
 
 	return alg;
@@ -808,10 +2225,12 @@ _NT_algorithm* construct(const _NT_algorithmMemoryPtrs& ptrs, const _NT_algorith
 
 // ============================================================
 // parameterString — display names for sample folder/file selectors
+// and units the host has no enum for
 //
 // Called by the host for parameters with kNT_unitHasStrings or
 // kNT_unitConfirm. Returns the folder/file name from the SD card
-// for display in the parameter UI instead of a raw numeric index.
+// for display in the parameter UI instead of a raw numeric index,
+// Harm Tilt as a slope in dB/oct and the additive phases in degrees.
 // ============================================================
 
 int parameterString(_NT_algorithm* self, int p, int v, char* buff)
@@ -845,6 +2264,21 @@ int parameterString(_NT_algorithm* self, int p, int v, char* buff)
 		}
 	}
 		break;
+	case kParamHarmTilt:
+		if (v > 0)
+			buff[len++] = '+';
+		len += NT_floatToString(buff + len, (float)v / 10.0f, 1);
+		strcpy(buff + len, " dB/oct");
+		len = strlen(buff);
+		break;
+	default:
+		if (p >= kParamHarmPhase1 && p <= kParamHarmPhaseLast)
+		{
+			len = NT_floatToString(buff, (float)v, 0);
+			strcpy(buff + len, " deg");
+			len = strlen(buff);
+		}
+		break;
 	}
 
 	return len;
@@ -854,6 +2288,60 @@ int parameterString(_NT_algorithm* self, int p, int v, char* buff)
 // Helper: update Free Run voice frequencies from base pitch + intervals
 // ============================================================
 
+// Pitch of voice v of a Free Run chord on the Base Pitch key: exact
+// ratios for the harmonic chords, scale steps for the tonal ones.
+static float chordPitchOct(const _pulsarAlgorithm* pThis, int chordType, int v)
+{
+	int base = pThis->v[kParamBasePitch];
+	if (chordType < kNumRatioChords)
+		return pThis->noteOct[base] + chordOctaves[chordType][v];
+	int n = base + pThis->chordSteps[chordType][v];
+	return pThis->noteOct[n < 127 ? n : 127];
+}
+
+// New target pitch (log2 Hz) for a voice. Without glide, or on a
+// voice's first note, the pitch jumps there at its next sample.
+static void setTargetPitch(const _pulsarAlgorithm* pThis, _pulsarVoice& voice, float oct)
+{
+	voice.targetOct = oct;
+	if (pThis->glideMs <= 0.0f || voice.fundamentalHz <= 0.0f)
+	{
+		voice.pitchOct = oct;
+		voice.pitchJump = true;
+	}
+	voice.pitchTick = true;
+}
+
+// Master phase of a voice starting a note (or joining a Free Run
+// chord). Free leaves it running; Reset starts the period now; Stagger
+// offsets voice v by v/count of a period so voices never pulse on the
+// same sample. A phase of 1.0 wraps on the next sample, so the first
+// pulse fires immediately; that wrap is flagged so it doesn't carry the
+// cut pulsaret on as a tail. Rotors resync exactly after the jump.
+static void startVoicePhase(const _pulsarAlgorithm* pThis, _pulsarVoice& voice, int v, int count)
+{
+	if (pThis->voicePhase == kPhaseFree)
+		return;
+	float phase = (pThis->voicePhase == kPhaseStagger) ? (float)v / (float)count : 0.0f;
+	voice.masterPhase = (phase > 0.0f) ? phase : 1.0f;
+	voice.phaseRestart = (phase == 0.0f);
+	for (int f = 0; f < 3; ++f)
+		voice.rot[f].valid = 0;
+}
+
+// A voice starting a note (MIDI, CV gate, steal or Free Run): per-note
+// state that glides from its previous value starts afresh, the snapshot
+// latches at once rather than waiting for a wrap, then the master phase
+// follows the Voice Phase policy.
+static void startVoiceNote(const _pulsarAlgorithm* pThis, _pulsarVoice& voice, int v, int count)
+{
+	for (int f = 0; f < 3; ++f)
+		voice.harmRatio[f] = 0.0f;
+	voice.formantTrackMul = 0.0f;
+	voice.forceLatch = true;
+	startVoicePhase(pThis, voice, v, count);
+}
+
 static void updateFreeRunVoices(_pulsarAlgorithm* pThis)
 {
 	_pulsarDTC* dtc = pThis->dtc;
@@ -865,13 +2353,12 @@ static void updateFreeRunVoices(_pulsarAlgorithm* pThis)
 		_pulsarVoice& voice = dtc->voices[v];
 		if (v < vc)
 		{
-			float hz = pThis->basePitchHz * chordRatios[intSet][v];
+			if (!voice.gate)
+				startVoiceNote(pThis, voice, v, vc);
 			voice.gate = true;
 			voice.envTarget = 1.0f;
 			voice.velocity = 127;
-			voice.targetFundamentalHz = hz;
-			if (voice.fundamentalHz <= 0.0f || pThis->glideMs <= 0.0f)
-				voice.fundamentalHz = hz;
+			setTargetPitch(pThis, voice, chordPitchOct(pThis, intSet, v));
 		}
 		else
 		{
@@ -897,12 +2384,59 @@ void parameterChanged(_NT_algorithm* self, int p)
 	float sr = static_cast<float>(NT_globals.sampleRate);
 	int algIdx = NT_algorithmIndex(self);
 	uint32_t offset = NT_parameterOffset();
+	++pThis->cacheGen;
+
+	// Step sequencer lanes: each lane is a contiguous block of Length, Div, steps
+	if (p >= kParamSeqFmtLength && p <= kParamSeqPanStepLast)
+	{
+		int lane = (p - kParamSeqFmtLength) / kSeqLaneParams;
+		int k = (p - kParamSeqFmtLength) % kSeqLaneParams;
+		if (k == 0)
+		{
+			pThis->seqLength[lane] = (uint8_t)pThis->v[p];
+			if (algIdx >= 0)
+			{
+				NT_setParameterGrayedOut(algIdx, p + 1 + offset, pThis->seqLength[lane] == 0);
+				for (int s = 0; s < kSeqMaxSteps; ++s)
+					NT_setParameterGrayedOut(algIdx, p + 2 + s + offset, s >= pThis->seqLength[lane]);
+			}
+		}
+		else if (k == 1)
+			pThis->seqDiv[lane] = (uint8_t)pThis->v[p];
+		else
+			pThis->seqSteps[lane][k - 2] = pThis->v[p];
+		return;
+	}
+
+	// Additive harmonics: amplitude or phase of one harmonic
+	if (p >= kParamHarmAmp1 && p <= kParamHarmPhaseLast)
+	{
+		if (p <= kParamHarmAmpLast)
+			pThis->harmAmp[p - kParamHarmAmp1] = pThis->v[p] / 100.0f;
+		else
+			pThis->harmPhase[p - kParamHarmPhase1] = pThis->v[p] * (2.0f * (float)M_PI / 360.0f);
+		pThis->additiveDirty = true;
+		return;
+	}
 
 	switch (p)
 	{
 	case kParamPulsaret:
 		pThis->pulsaretIndex = pThis->v[kParamPulsaret] / 10.0f;
 		break;
+	case kParamPulsaretY:
+		pThis->pulsaretY = pThis->v[kParamPulsaretY] / 100.0f;
+		break;
+	case kParamAdditive:
+		pThis->additive = pThis->v[kParamAdditive];
+		break;
+	case kParamNoiseType:
+		pThis->noiseType = pThis->v[kParamNoiseType];
+		break;
+	case kParamHarmTilt:
+		pThis->harmTilt = pThis->v[kParamHarmTilt] / 10.0f;
+		pThis->additiveDirty = true;
+		break;
 	case kParamWindow:
 		pThis->windowIndex = pThis->v[kParamWindow] / 10.0f;
 		break;
@@ -918,8 +2452,8 @@ void parameterChanged(_NT_algorithm* self, int p)
 		// Gray out unused formant/pan params
 		if (algIdx >= 0)
 		{
-			NT_setParameterGrayedOut(algIdx, kParamFormant2Hz + offset, pThis->formantCount < 2);
-			NT_setParameterGrayedOut(algIdx, kParamFormant3Hz + offset, pThis->formantCount < 3);
+			NT_setParameterGrayedOut(algIdx, kParamFormant2Hz + offset, pThis->formantCount < 2 || pThis->vowelMode);
+			NT_setParameterGrayedOut(algIdx, kParamFormant3Hz + offset, pThis->formantCount < 3 || pThis->vowelMode);
 			NT_setParameterGrayedOut(algIdx, kParamPan2 + offset, pThis->formantCount < 2);
 			NT_setParameterGrayedOut(algIdx, kParamPan3 + offset, pThis->formantCount < 3);
 		}
@@ -933,6 +2467,37 @@ void parameterChanged(_NT_algorithm* self, int p)
 	case kParamFormant3Hz:
 		pThis->formantHz[2] = (float)pThis->v[kParamFormant3Hz];
 		break;
+	case kParamHarmLock:
+		pThis->harmLock = pThis->v[kParamHarmLock];
+		// Engaging the lock lands on the nearest harmonic, not a stale one
+		if (pThis->harmLock)
+			for (int v = 0; v < kMaxVoices; ++v)
+				for (int f = 0; f < 3; ++f)
+					dtc->voices[v].harmRatio[f] = 0.0f;
+		break;
+	case kParamVowelMode:
+		pThis->vowelMode = pThis->v[kParamVowelMode];
+		// The vowel plane replaces the Formant Hz params
+		if (algIdx >= 0)
+		{
+			NT_setParameterGrayedOut(algIdx, kParamFormant1Hz + offset, pThis->vowelMode);
+			NT_setParameterGrayedOut(algIdx, kParamFormant2Hz + offset, pThis->formantCount < 2 || pThis->vowelMode);
+			NT_setParameterGrayedOut(algIdx, kParamFormant3Hz + offset, pThis->formantCount < 3 || pThis->vowelMode);
+			NT_setParameterGrayedOut(algIdx, kParamVowel + offset, !pThis->vowelMode);
+			NT_setParameterGrayedOut(algIdx, kParamVoiceType + offset, !pThis->vowelMode);
+		}
+		break;
+	case kParamVowel:
+		pThis->vowel = pThis->v[kParamVowel] / 10.0f;
+		break;
+	case kParamVoiceType:
+		pThis->voiceType = pThis->v[kParamVoiceType] / 10.0f;
+		break;
+	case kParamHarmGlide:
+		pThis->harmGlideMs = pThis->v[kParamHarmGlide] / 10.0f;
+		for (int v = 0; v < kMaxVoices; ++v)
+			dtc->voices[v].harmGlideCoeff = coeffFromMs(pThis->harmGlideMs, sr);
+		break;
 
 	case kParamMaskMode:
 		pThis->maskMode = pThis->v[kParamMaskMode];
@@ -1033,8 +2598,11 @@ void parameterChanged(_NT_algorithm* self, int p)
 			NT_setParameterGrayedOut(algIdx, kParamBasePitch + offset, pThis->gateMode == 0);
 			NT_setParameterGrayedOut(algIdx, kParamMidiCh + offset, pThis->gateMode != 0);
 			NT_setParameterGrayedOut(algIdx, kParamChordType + offset, pThis->gateMode != 1);
-			NT_setParameterGrayedOut(algIdx, kParamVoiceCount + offset, pThis->gateMode == 2);
-			NT_setParameterGrayedOut(algIdx, kParamGateCV + offset, pThis->gateMode != 2);
+			NT_setParameterGrayedOut(algIdx, kParamChordLock + offset, pThis->gateMode != 1);
+			NT_setParameterGrayedOut(algIdx, kParamVoiceCount + offset, pThis->gateMode >= 2);
+			NT_setParameterGrayedOut(algIdx, kParamGateCV + offset, pThis->gateMode < 2);
+			for (int q = kParamGate2CV; q <= kParamPitch4CV; ++q)
+				NT_setParameterGrayedOut(algIdx, q + offset, pThis->gateMode != 3);
 		}
 		if (pThis->gateMode == 1)
 		{
@@ -1044,9 +2612,9 @@ void parameterChanged(_NT_algorithm* self, int p)
 			// Free Run: set up all active voices with interval ratios
 			updateFreeRunVoices(pThis);
 		}
-		else if (pThis->gateMode == 2)
+		else if (pThis->gateMode >= 2)
 		{
-			// CV: default amplitude to 80%
+			// CV and Poly CV: default amplitude to 80%
 			if (algIdx >= 0)
 				NT_setParameterFromUi(algIdx, kParamAmplitude + offset, 80);
 			// CV: fully reset all voices so no Free Run state bleeds through
@@ -1056,10 +2624,10 @@ void parameterChanged(_NT_algorithm* self, int p)
 				dtc->voices[v].envTarget = 0.0f;
 				dtc->voices[v].envValue = 0.0f;
 				dtc->voices[v].fundamentalHz = 0.0f;
-				dtc->voices[v].targetFundamentalHz = 0.0f;
 				dtc->voices[v].masterPhase = 0.0f;
 			}
 			dtc->prevGateHigh = false;
+			dtc->polyGates = 0;
 			dtc->activeVoiceIdx = -1;
 		}
 		else
@@ -1073,11 +2641,27 @@ void parameterChanged(_NT_algorithm* self, int p)
 		}
 		break;
 	case kParamBasePitch:
-		pThis->basePitchHz = 440.0f * exp2f((pThis->v[kParamBasePitch] - 69) / 12.0f);
+		pThis->basePitchOct = pThis->noteOct[pThis->v[kParamBasePitch]];
+		pThis->basePitchHz = exp2f(pThis->basePitchOct);
+		if (pThis->gateMode == 1)
+			updateFreeRunVoices(pThis);
+		break;
+	case kParamTuning:
+	case kParamTuningRoot:
+		buildTuning(pThis->noteOct, pThis->chordSteps, pThis->v[kParamTuning], pThis->v[kParamTuningRoot]);
+		pThis->basePitchOct = pThis->noteOct[pThis->v[kParamBasePitch]];
+		pThis->basePitchHz = exp2f(pThis->basePitchOct);
 		if (pThis->gateMode == 1)
 			updateFreeRunVoices(pThis);
 		break;
 
+	case kParamVoicePhase:
+		pThis->voicePhase = pThis->v[kParamVoicePhase];
+		// Free Run: re-seat the running chord so the choice is heard
+		if (pThis->gateMode == 1)
+			for (int v = 0; v < pThis->voiceCount; ++v)
+				startVoicePhase(pThis, dtc->voices[v], v, pThis->voiceCount);
+		break;
 	case kParamVoiceCount:
 		pThis->voiceCount = pThis->v[kParamVoiceCount];
 		if (pThis->gateMode == 1)
@@ -1099,12 +2683,95 @@ void parameterChanged(_NT_algorithm* self, int p)
 		// scaling10 gives ±10.0, multiply by 0.2 → ±2.0 octaves
 		pThis->glissonDepth = pThis->v[kParamGlisson] * 0.02f;
 		break;
+	case kParamGlissCurve:
+		pThis->glissCurve = pThis->v[kParamGlissCurve];
+		break;
+	case kParamGlissF2:
+		pThis->glissScale[1] = pThis->v[kParamGlissF2] / 100.0f;
+		break;
+	case kParamGlissF3:
+		pThis->glissScale[2] = pThis->v[kParamGlissF3] / 100.0f;
+		break;
 	case kParamPerFormantMask:
 		pThis->perFormantMask = pThis->v[kParamPerFormantMask];
 		break;
 	case kParamFormantTrack:
 		pThis->formantTrack = pThis->v[kParamFormantTrack];
+		if (algIdx >= 0)
+		{
+			NT_setParameterGrayedOut(algIdx, kParamTrackAmount + offset, !pThis->formantTrack);
+			NT_setParameterGrayedOut(algIdx, kParamTrackCentre + offset, !pThis->formantTrack);
+		}
+		break;
+	case kParamTrackAmount:
+		pThis->trackAmount = pThis->v[kParamTrackAmount] / 100.0f;
+		break;
+	case kParamTrackCentre:
+		pThis->trackCentre = pThis->v[kParamTrackCentre];
+		break;
+	case kParamFormantCVMode:
+		pThis->formantCVMode = pThis->v[kParamFormantCVMode];
+		break;
+	case kParamLatch:
+		pThis->latchMode = pThis->v[kParamLatch];
+		break;
+	case kParamWindowType:
+		pThis->windowType = pThis->v[kParamWindowType];
+		pThis->windowDirty = true;
+		if (algIdx >= 0)
+		{
+			NT_setParameterGrayedOut(algIdx, kParamWindow + offset, pThis->windowType != 0);
+			NT_setParameterGrayedOut(algIdx, kParamWindowShape + offset, pThis->windowType == 0 || pThis->windowType == 5);
+		}
+		break;
+	case kParamWindowShape:
+		pThis->windowShape = pThis->v[kParamWindowShape] / 100.0f;
+		pThis->windowDirty = true;
+		break;
+	case kParamInterp:
+		pThis->hermite = (pThis->v[kParamInterp] == 1);
 		break;
+	case kParamPulsaretMorph:
+		pThis->spectralMorph = (pThis->v[kParamPulsaretMorph] == 1) && pThis->morphSteps > 1;
+		break;
+	}
+}
+
+// ============================================================
+// Step sequencer lanes
+//
+// Lanes advance once per pulse of their own voice. Each active lane
+// holds a step for Div pulses, then moves on, wrapping at Length.
+// Inactive lanes output their neutral value (no offset, unity amp).
+// ============================================================
+
+static void resetSeqLanes(_pulsarVoice& voice)
+{
+	for (int lane = 0; lane < kNumLanes; ++lane)
+	{
+		voice.seqPos[lane] = 0;
+		voice.seqDivCount[lane] = 0;
+	}
+}
+
+static inline void advanceSeqLanes(const _pulsarAlgorithm* pThis, _pulsarVoice& voice)
+{
+	for (int lane = 0; lane < kNumLanes; ++lane)
+	{
+		int len = pThis->seqLength[lane];
+		if (len == 0)
+		{
+			voice.seqValue[lane] = (lane == kLaneAmp) ? 1.0f : 0.0f;
+			continue;
+		}
+		if (voice.seqDivCount[lane] == 0)
+		{
+			if (voice.seqPos[lane] >= len) voice.seqPos[lane] = 0;
+			voice.seqValue[lane] = pThis->seqSteps[lane][voice.seqPos[lane]] * kSeqLaneScale[lane];
+			voice.seqPos[lane] = (uint8_t)((voice.seqPos[lane] + 1) % len);
+		}
+		if (++voice.seqDivCount[lane] >= pThis->seqDiv[lane])
+			voice.seqDivCount[lane] = 0;
 	}
 }
 
@@ -1214,87 +2881,595 @@ void midiMessage(_NT_algorithm* self, uint8_t byte0, uint8_t byte1, uint8_t byte
 
 			// Assign note to chosen voice
 			_pulsarVoice& voice = dtc->voices[chosen];
+			startVoiceNote(pThis, voice, chosen, pThis->voiceCount);
 			voice.currentNote = byte1;
 			voice.velocity = byte2;
 			voice.gate = true;
 			voice.envTarget = 1.0f;
-			voice.targetFundamentalHz = 440.0f * exp2f((byte1 - 69) / 12.0f);
-			if (pThis->glideMs <= 0.0f || voice.fundamentalHz <= 0.0f)
-				voice.fundamentalHz = voice.targetFundamentalHz;
+			setTargetPitch(pThis, voice, pThis->noteOct[byte1]);
+			resetSeqLanes(voice);
 			dtc->voiceAge[chosen] = dtc->nextVoiceAge++;
 		}
-		break;
+		break;
+	}
+}
+
+// ============================================================
+// Inline helpers for audio processing
+//
+// These are called per-sample in the inner loop and must be fast.
+// Table reads use linear or 4-point Hermite interpolation with
+// power-of-2 wrapping.
+// ============================================================
+
+// Read a single table with linear interpolation.
+// phase is 0.0–1.0, tableSize must be a power of 2 for the bitmask wrap.
+static inline float readTableLerp(const float* table, int tableSize, float phase)
+{
+	float pos = phase * tableSize;
+	int idx = (int)pos;
+	float frac = pos - idx;
+	idx &= (tableSize - 1);
+	int idx2 = (idx + 1) & (tableSize - 1);
+	return table[idx] + frac * (table[idx2] - table[idx]);
+}
+
+// Read a single table with 4-point, 3rd-order Hermite (Catmull-Rom)
+// interpolation. Twice the loads of readTableLerp, but the error falls
+// with the cube of the step: a 512-point sine read this way sits about
+// 30 dB below a 2048-point one read linearly. Tables with a kink at the
+// wrap (sinc, Gaussian, pulse) gain less.
+static inline float readTableHermite(const float* table, int tableSize, float phase)
+{
+	float pos = phase * tableSize;
+	int idx = (int)pos;
+	float frac = pos - idx;
+	int mask = tableSize - 1;
+	float ym = table[(idx - 1) & mask];
+	float y0 = table[idx & mask];
+	float y1 = table[(idx + 1) & mask];
+	float y2 = table[(idx + 2) & mask];
+	float c1 = 0.5f * (y1 - ym);
+	float c2 = ym - 2.5f * y0 + 2.0f * y1 - 0.5f * y2;
+	float c3 = 0.5f * (y2 - ym) + 1.5f * (y0 - y1);
+	return ((c3 * frac + c2) * frac + c1) * frac + y0;
+}
+
+// Read from the pulsaret table bank with bilinear morphing.
+// index is 0.0–9.0: integer part selects two adjacent tables,
+// fractional part crossfades between them.
+static inline float readTableMorph(const float tables[][kTableSize], float index, float phase,
+                                   bool hermite = false)
+{
+	int idx0 = (int)index;
+	float frac = index - idx0;
+	if (idx0 < 0) { idx0 = 0; frac = 0.0f; }
+	if (idx0 >= kNumPulsarets - 1) { idx0 = kNumPulsarets - 2; frac = 1.0f; }
+	float s0, s1;
+	if (hermite)
+	{
+		s0 = readTableHermite(tables[idx0], kTableSize, phase);
+		s1 = readTableHermite(tables[idx0 + 1], kTableSize, phase);
+	}
+	else
+	{
+		s0 = readTableLerp(tables[idx0], kTableSize, phase);
+		s1 = readTableLerp(tables[idx0 + 1], kTableSize, phase);
+	}
+	return s0 + frac * (s1 - s0);
+}
+
+// Read band-limited level (1..kMipLevels) of the pulsaret bank with
+// the same morph as readTableMorph.
+static inline float readMipMorph(const float mips[][kMipTotal], int level, float index, float phase,
+                                 bool hermite)
+{
+	int idx0 = (int)index;
+	float frac = index - idx0;
+	if (idx0 < 0) { idx0 = 0; frac = 0.0f; }
+	if (idx0 >= kNumPulsarets - 1) { idx0 = kNumPulsarets - 2; frac = 1.0f; }
+	int size = mipSize(level);
+	int offset = mipOffset(level);
+	const float* t0 = mips[idx0] + offset;
+	const float* t1 = mips[idx0 + 1] + offset;
+	float s0 = hermite ? readTableHermite(t0, size, phase) : readTableLerp(t0, size, phase);
+	float s1 = hermite ? readTableHermite(t1, size, phase) : readTableLerp(t1, size, phase);
+	return s0 + frac * (s1 - s0);
+}
+
+// Band-limited level for a pulsaret playing cps table cycles per
+// sample: the first level whose harmonics all fit below Nyquist.
+static inline int mipLevel(float cps)
+{
+	float limit = 0.5f / cps;
+	if (limit >= (float)(kTableSize / 2))
+		return 0;
+	int level = 1;
+	for (int h = kTableSize / 4; (float)h > limit && level < kMipLevels; h >>= 1)
+		++level;
+	return level;
+}
+
+// Read from the window table bank with bilinear morphing.
+// Same as readTableMorph but clamped to kNumWindows.
+static inline float readWindowMorph(const float tables[][kTableSize], float index, float phase)
+{
+	int idx0 = (int)index;
+	float frac = index - idx0;
+	if (idx0 < 0) { idx0 = 0; frac = 0.0f; }
+	if (idx0 >= kNumWindows - 1) { idx0 = kNumWindows - 2; frac = 1.0f; }
+	float s0 = readTableLerp(tables[idx0], kTableSize, phase);
+	float s1 = readTableLerp(tables[idx0 + 1], kTableSize, phase);
+	return s0 + frac * (s1 - s0);
+}
+
+#ifdef SPALUTER_INTERLEAVED_TABLES
+// Morphing lerp read from an interleaved bank: one entry gives both
+// tables' value and delta. index is clamped to numTables - 1 like
+// readTableMorph / readWindowMorph.
+static inline float readPairMorph(const _tablePair pairs[][kTableSize], int numTables, float index, float phase)
+{
+	int idx0 = (int)index;
+	float frac = index - idx0;
+	if (idx0 < 0) { idx0 = 0; frac = 0.0f; }
+	if (idx0 >= numTables - 1) { idx0 = numTables - 2; frac = 1.0f; }
+	float pos = phase * kTableSize;
+	int idx = (int)pos;
+	float f = pos - idx;
+	const _tablePair& e = pairs[idx0][idx & (kTableSize - 1)];
+	float s0 = e.v0 + f * e.d0;
+	float s1 = e.v1 + f * e.d1;
+	return s0 + frac * (s1 - s0);
+}
+#endif
+
+// Read the spectral morph grid. pos is the pulsaret index scaled by
+// the grid steps; neighbouring grid tables are crossfaded.
+static inline float readGridMorph(const float* const* grid, int last, float pos, float phase, bool hermite)
+{
+	int idx0 = (int)pos;
+	float frac = pos - idx0;
+	if (idx0 < 0) { idx0 = 0; frac = 0.0f; }
+	if (idx0 >= last) { idx0 = last - 1; frac = 1.0f; }
+	float s0, s1;
+	if (hermite)
+	{
+		s0 = readTableHermite(grid[idx0], kTableSize, phase);
+		s1 = readTableHermite(grid[idx0 + 1], kTableSize, phase);
+	}
+	else
+	{
+		s0 = readTableLerp(grid[idx0], kTableSize, phase);
+		s1 = readTableLerp(grid[idx0 + 1], kTableSize, phase);
+	}
+	return s0 + frac * (s1 - s0);
+}
+
+// Fast Padé approximation of tanh for soft clipping.
+// tanh(x) ≈ x(27+x²)/(27+9x²), accurate to <1% for |x| < 3.
+static inline float fastTanh(float x)
+{
+	float x2 = x * x;
+	return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+}
+
+// Fast exp2 approximation for 1V/oct pitch CV processing.
+// Uses integer bit manipulation + cubic polynomial refinement.
+// Accurate to ~1 cent over [-4, 4] range (±4 octaves).
+static inline float fastExp2f(float x)
+{
+	float fi = floorf(x);
+	float f = x - fi;
+	// Cubic polynomial for 2^f on [0,1)
+	float p = f * (f * (f * 0.079441f + 0.227411f) + 0.693147f) + 1.0f;
+	// Apply integer part by adding to IEEE 754 exponent bits
+	union { float fv; int32_t iv; } u;
+	u.fv = p;
+	u.iv += (int32_t)fi << 23;
+	return u.fv;
+}
+
+// Fast log2 approximation, the inverse of fastExp2f: the exponent
+// bits plus a cubic on the mantissa. Accurate to ~1.3 cents for any
+// positive normal x.
+static inline float fastLog2f(float x)
+{
+	union { float fv; int32_t iv; } u;
+	u.fv = x;
+	float e = (float)(((u.iv >> 23) & 0xff) - 127);
+	u.iv = (u.iv & 0x007fffff) | 0x3f800000;
+	float t = u.fv - 1.0f;
+	return e + t * (1.4208645f + t * (-0.5772507f + t * 0.1563861f));
+}
+
+// Phase-rotation oscillator: (c, s) = (cos θ, sin θ) advanced by a small
+// angle d per sample with a 4th-order Taylor rotation — six multiplies,
+// no table traffic. Only used while d ≤ kRotMaxStep (error < 1e-6 per
+// step); callers resync exactly with rotatorSet() at each pulse.
+static const float kTwoPi = 2.0f * (float)M_PI;
+static const float kRotMaxStep = 0.25f;
+
+static inline void rotatorSet(float& c, float& s, float theta)
+{
+	c = cosf(theta);
+	s = sinf(theta);
+}
+
+static inline void rotatorAdvance(float& c, float& s, float d)
+{
+	float d2 = d * d;
+	float cd = 1.0f - d2 * (0.5f - d2 * (1.0f / 24.0f));
+	float sd = d * (1.0f - d2 * (1.0f / 6.0f));
+	float c1 = c * cd - s * sd;
+	s = s * cd + c * sd;
+	c = c1;
+}
+
+// Band noise: a Q = 2 band-pass SVF centred on the formant, its gain
+// compensated for the bandwidth. Updated every kNoiseBlock samples.
+static void setNoiseBand(_noiseBand& bp, float centreHz, float invSr)
+{
+	float fc = centreHz * invSr;
+	if (fc < 0.0005f) fc = 0.0005f;
+	if (fc > 0.45f) fc = 0.45f;
+	const float k = 0.5f; // 1 / Q
+	float g = tanf((float)M_PI * fc);
+	bp.a1 = 1.0f / (1.0f + g * (g + k));
+	bp.a2 = g * bp.a1;
+	bp.a3 = g * bp.a2;
+	bp.gain = 0.75f * k / sqrtf(k * g);
+}
+
+// Next sample of one noise stream. White comes from xorshift32; Pink
+// runs it through Kellet's three-pole economy filter; Band through the
+// formant's SVF.
+static inline float nextNoise(_noiseSource& ns, int type, const _noiseBand& bp)
+{
+	uint32_t x = ns.seed;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	ns.seed = x;
+	float w = (float)(int32_t)x * (1.0f / 2147483648.0f);
+
+	if (type == kNoisePink)
+	{
+		ns.b0 = 0.99765f * ns.b0 + w * 0.0990460f;
+		ns.b1 = 0.96300f * ns.b1 + w * 0.2965164f;
+		ns.b2 = 0.57000f * ns.b2 + w * 1.0526913f;
+		return (ns.b0 + ns.b1 + ns.b2 + w * 0.1848f) * 0.25f;
+	}
+	if (type == kNoiseBand)
+	{
+		float v3 = w - ns.ic2;
+		float v1 = bp.a1 * ns.ic1 + bp.a2 * v3;
+		float v2 = ns.ic2 + bp.a2 * ns.ic1 + bp.a3 * v3;
+		ns.ic1 = 2.0f * v1 - ns.ic1;
+		ns.ic2 = 2.0f * v2 - ns.ic2;
+		return v1 * bp.gain;
+	}
+	return w;
+}
+
+// Window value for one pulsaret. hannCos is the pulsaret's rotator
+// cosine when the Hann recurrence is usable, NULL to read the table.
+static inline float readWindow(const _pulsarAlgorithm* pThis, const _voiceSnapshot& vs,
+                               float pulsaretPhase, const float* hannCos)
+{
+	const _pulsarDRAM* dram = pThis->dram;
+	switch (vs.windowPath)
+	{
+	case kWindowPathRect:
+		return 1.0f;
+	case kWindowPathLinear:
+		return 1.0f - pulsaretPhase;
+	case kWindowPathHann:
+		if (hannCos)
+			return 0.5f - 0.5f * *hannCos;
+		return readTableLerp(dram->windowTables[2], kTableSize, pulsaretPhase);
+	case kWindowPathWork:
+		return readTableLerp(dram->windowWork[vs.workFront[kWorkWindow]], kTableSize, pulsaretPhase);
+	}
+#ifdef SPALUTER_INTERLEAVED_TABLES
+	return readPairMorph(dram->windowPairs, kNumWindows, vs.windowIdx, pulsaretPhase);
+#else
+	return readWindowMorph(dram->windowTables, vs.windowIdx, pulsaretPhase);
+#endif
+}
+
+// Gain on a partial at cps cycles per sample: full up to half Nyquist,
+// fading to silence at Nyquist (the formantAtten curve).
+static inline float partialGain(float cps)
+{
+	return (cps <= 0.25f) ? 1.0f : (cps >= 0.5f) ? 0.0f : 2.0f - 4.0f * cps;
+}
+
+// Sine-family pulsarets (0–2: sine, sine×2, sine×3) from one quadrature
+// pair: sin 2θ = 2 s c, sin 3θ = s (3 - 4 s²), morphed like the tables.
+// cps is the fundamental's cycles per sample; the ×2 and ×3 partials fade
+// out before they reach Nyquist, as the mip levels do for the tables.
+static inline float sineFamily(float index, float s, float c, float cps)
+{
+	float s2 = 2.0f * s * c * partialGain(2.0f * cps);
+	if (index <= 1.0f)
+		return s + index * (s2 - s);
+	float s3 = s * (3.0f - 4.0f * s * s) * partialGain(3.0f * cps);
+	return s2 + (index - 1.0f) * (s3 - s2);
+}
+
+// Glisson multiplier on one pulsaret's table rate this sample. age is
+// the master phase elapsed since its pulse, advanced by phaseInc.
+// Exp costs one multiply per sample (exact restart at each pulse);
+// the shaped curves are fixed per pulse and follow pulsaretPhase.
+// fm: the rate changes every sample, which breaks the Exp recurrence,
+// so the sweep is evaluated directly with one fast exp2 instead.
+static inline float glissonMul(_pulsaretRotor& rot, int curve, float depth, float age, float phaseInc,
+                               float duty, float pulsaretPhase, bool resync, bool fm)
+{
+	if (depth == 0.0f)
+	{
+		rot.valid &= (uint8_t)~kRotorGliss;
+		return 1.0f;
+	}
+	if (fm && curve == kGlissExp)
+	{
+		rot.valid &= (uint8_t)~kRotorGliss;
+		return fastExp2f(depth * age);
+	}
+	if (resync || !(rot.valid & kRotorGliss) || rot.glissCurve != curve)
+	{
+		// Once per pulse, so exact exp2f: the recurrence compounds any
+		// error in the step across the whole pulsaret
+		if (curve == kGlissExp)
+		{
+			rot.gliss = exp2f(depth * age);
+			rot.glissStep = exp2f(depth * phaseInc);
+		}
+		else
+		{
+			rot.glissStep = exp2f(depth * duty) - 1.0f;
+		}
+		rot.glissCurve = (uint8_t)curve;
+		rot.valid |= kRotorGliss;
+		if (curve == kGlissExp)
+			return rot.gliss;
+	}
+	else if (curve == kGlissExp)
+	{
+		rot.gliss *= rot.glissStep;
+		return rot.gliss;
+	}
+	if (curve == kGlissLinear)
+		return 1.0f + rot.glissStep * pulsaretPhase;
+	float pos = pulsaretPhase * kGlissCurveSize;
+	int idx = (int)pos;
+	if (idx >= kGlissCurveSize) idx = kGlissCurveSize - 1;
+	float frac = pos - idx;
+	float c = glissSCurve[idx] + frac * (glissSCurve[idx + 1] - glissSCurve[idx]);
+	return 1.0f + rot.glissStep * c;
+}
+
+// Render one windowed pulsaret sample (before mask and pan).
+// pulsaretPhase runs 0–1 across the pulsaret and advanced by phaseStep
+// this sample; gliss is its glisson multiplier (glissonMul); ratio is
+// the number of pulsaret cycles per fundamental period. resync
+// restarts the rotor recurrences exactly (new pulse). noise is this
+// sample of the formant's live noise (vs.liveNoise).
+static inline float renderPulsaret(const _pulsarAlgorithm* pThis, const _voiceSnapshot& vs,
+                                   _pulsaretRotor& rot, float pulsaretPhase, float gliss,
+                                   float ratio, float phaseStep, bool resync, int mip, float noise)
+{
+	const _pulsarDRAM* dram = pThis->dram;
+	float sample;
+
+	if (vs.useSample && pThis->sampleLoadedFrames >= 2)
+	{
+		// Sample-based pulsaret
+		float samplePos = pulsaretPhase * (pThis->sampleLoadedFrames - 1) * vs.sampleRateRatio;
+		int sIdx = (int)samplePos;
+		float sFrac = samplePos - sIdx;
+		if (sIdx < 0) sIdx = 0;
+		if (sIdx >= pThis->sampleLoadedFrames - 1) sIdx = pThis->sampleLoadedFrames - 2;
+		sample = dram->sampleBuffer[sIdx] + sFrac * (dram->sampleBuffer[sIdx + 1] - dram->sampleBuffer[sIdx]);
+	}
+	else if (vs.sinePath)
+	{
+		// Sine family from a quadrature rotation: exact phase at each
+		// pulse, then one complex multiply per sample. When the step
+		// changes (glide, pitch CV, FM under a latched ratio) the rotation
+		// itself is turned by the difference and renormalised, so a
+		// ramping rate stays one rotation per sample rather than a
+		// sinf/cosf pair; only jumps beyond kRotMaxStep recompute it.
+		float step = kTwoPi * ratio * phaseStep;
+		if (resync || !(rot.valid & kRotorOsc))
+		{
+			float tablePhase = pulsaretPhase * ratio;
+			tablePhase -= static_cast<float>(static_cast<int>(tablePhase));
+			rotatorSet(rot.oscC, rot.oscS, kTwoPi * tablePhase);
+			rotatorSet(rot.oscCd, rot.oscSd, step);
+			rot.oscStep = step;
+			rot.valid |= kRotorOsc;
+		}
+		else
+		{
+			float delta = step - rot.oscStep;
+			if (delta != 0.0f)
+			{
+				if (fabsf(delta) <= kRotMaxStep)
+				{
+					rotatorAdvance(rot.oscCd, rot.oscSd, delta);
+					float g = 1.5f - 0.5f * (rot.oscCd * rot.oscCd + rot.oscSd * rot.oscSd);
+					rot.oscCd *= g;
+					rot.oscSd *= g;
+				}
+				else
+				{
+					rotatorSet(rot.oscCd, rot.oscSd, step);
+				}
+				rot.oscStep = step;
+			}
+			float c = rot.oscC * rot.oscCd - rot.oscS * rot.oscSd;
+			rot.oscS = rot.oscS * rot.oscCd + rot.oscC * rot.oscSd;
+			rot.oscC = c;
+		}
+		sample = sineFamily(vs.pulsaretIdx, rot.oscS, rot.oscC, ratio * phaseStep);
+	}
+	else
+	{
+		// Table-based pulsaret with morphing
+		rot.valid &= (uint8_t)~kRotorOsc;
+		// Glisson: pitch sweep within pulsaret
+		float tablePhase = pulsaretPhase * ratio * gliss;
+		tablePhase -= static_cast<float>(static_cast<int>(tablePhase));
+		if (vs.additive || vs.pulsaretWork)
+		{
+			const float* work = vs.additive ? dram->additiveWork[vs.workFront[kWorkAdditive]]
+			                                : dram->pulsaretWork[vs.workFront[kWorkPulsaret]];
+			sample = pThis->hermite ? readTableHermite(work, kTableSize, tablePhase)
+			                        : readTableLerp(work, kTableSize, tablePhase);
+		}
+		else if (vs.liveNoise)
+		{
+			// Pulse → live noise: the noise slot is replaced, the pulse
+			// table is still read for the morph
+			const float* pulse = dram->pulsaretTables[kNumPulsarets - 2];
+			float s0 = pThis->hermite ? readTableHermite(pulse, kTableSize, tablePhase)
+			                          : readTableLerp(pulse, kTableSize, tablePhase);
+			sample = s0 + (vs.pulsaretIdx - (float)(kNumPulsarets - 2)) * (noise - s0);
+		}
+		else if (pThis->spectralMorph)
+			sample = readGridMorph(pThis->morphGrid, (kNumPulsarets - 1) * pThis->morphSteps,
+			                       vs.pulsaretIdx * pThis->morphSteps, tablePhase, pThis->hermite);
+		else if (mip > 0)
+			sample = readMipMorph(dram->pulsaretMips, mip, vs.pulsaretIdx, tablePhase, pThis->hermite);
+		else
+#ifdef SPALUTER_INTERLEAVED_TABLES
+		if (!pThis->hermite)
+			sample = readPairMorph(dram->pulsaretPairs, kNumPulsarets, vs.pulsaretIdx, tablePhase);
+		else
+#endif
+		sample = readTableMorph(dram->pulsaretTables, vs.pulsaretIdx, tablePhase, pThis->hermite);
+	}
+
+	// Hann rotator: exact resync on a new pulse or a phase jump (duty
+	// change), recurrence otherwise, in either direction (FM can run the
+	// phase backwards); table read for very short pulsarets
+	const float* hannCos = NULL;
+	if (vs.windowPath == kWindowPathHann && kTwoPi * fabsf(phaseStep) <= kRotMaxStep)
+	{
+		float d = kTwoPi * (pulsaretPhase - rot.winPhase);
+		if (!resync && (rot.valid & kRotorWin) && fabsf(d) <= kRotMaxStep)
+			rotatorAdvance(rot.winC, rot.winS, d);
+		else
+			rotatorSet(rot.winC, rot.winS, kTwoPi * pulsaretPhase);
+		rot.winPhase = pulsaretPhase;
+		rot.valid |= kRotorWin;
+		hannCos = &rot.winC;
 	}
+	else
+	{
+		rot.valid &= (uint8_t)~kRotorWin;
+	}
+
+	return sample * readWindow(pThis, vs, pulsaretPhase, hannCos);
 }
 
 // ============================================================
-// Inline helpers for audio processing
+// Period render cache
 //
-// These are called per-sample in the inner loop and must be fast.
-// All table reads use linear interpolation with power-of-2 wrapping.
+// Called per voice at its first latch of a block and at each pulse.
+// A key that matches the previous check starts a fill; any mismatch
+// stores the new key and drops the cache. Periods longer than half
+// the table (fundamentals below ~23 Hz at 48 kHz) render live.
 // ============================================================
 
-// Read a single table with linear interpolation.
-// phase is 0.0–1.0, tableSize must be a power of 2 for the bitmask wrap.
-static inline float readTableLerp(const float* table, int tableSize, float phase)
-{
-	float pos = phase * tableSize;
-	int idx = (int)pos;
-	float frac = pos - idx;
-	idx &= (tableSize - 1);
-	int idx2 = (idx + 1) & (tableSize - 1);
-	return table[idx] + frac * (table[idx2] - table[idx]);
-}
-
-// Read from the pulsaret table bank with bilinear morphing.
-// index is 0.0–9.0: integer part selects two adjacent tables,
-// fractional part crossfades between them.
-static inline float readTableMorph(const float tables[][kTableSize], float index, float phase)
+static void checkPeriodCache(_pulsarAlgorithm* pThis, _periodCache& pc, const _pulsarVoice& voice,
+                             float phaseInc, bool cacheable)
 {
-	int idx0 = (int)index;
-	float frac = index - idx0;
-	if (idx0 < 0) { idx0 = 0; frac = 0.0f; }
-	if (idx0 >= kNumPulsarets - 1) { idx0 = kNumPulsarets - 2; frac = 1.0f; }
-	float s0 = readTableLerp(tables[idx0], kTableSize, phase);
-	float s1 = readTableLerp(tables[idx0 + 1], kTableSize, phase);
-	return s0 + frac * (s1 - s0);
+	float period = (phaseInc > 0.0f) ? 1.0f / phaseInc : 0.0f;
+	if (!cacheable || period < 1.0f || period > (float)(kPeriodCacheSize / 2))
+	{
+		pc.state = kCacheOff;
+		return;
+	}
+	bool match = pc.gen == pThis->cacheGen && pc.phaseInc == phaseInc
+		&& memcmp(pc.ratio, voice.formantRatio, sizeof(pc.ratio)) == 0
+		&& memcmp(pc.duty, voice.formantDuty, sizeof(pc.duty)) == 0
+		&& memcmp(pc.mask, voice.maskSmooth, sizeof(pc.mask)) == 0
+		&& memcmp(&pc.snap, &voice.snap, sizeof(_voiceSnapshot)) == 0;
+	if (!match)
+	{
+		memcpy(&pc.snap, &voice.snap, sizeof(_voiceSnapshot));
+		memcpy(pc.ratio, voice.formantRatio, sizeof(pc.ratio));
+		memcpy(pc.duty, voice.formantDuty, sizeof(pc.duty));
+		memcpy(pc.mask, voice.maskSmooth, sizeof(pc.mask));
+		memcpy(pc.invDuty, voice.formantInvDuty, sizeof(pc.invDuty));
+		memcpy(pc.mip, voice.formantMip, sizeof(pc.mip));
+		memcpy(pc.atten, voice.formantAtten, sizeof(pc.atten));
+		pc.phaseInc = phaseInc;
+		pc.gen = pThis->cacheGen;
+		pc.state = kCacheOff;
+		return;
+	}
+	if (pc.state == kCacheOff)
+	{
+		// At least two points per output sample for the Hermite read
+		int size = 64;
+		while (size < 2.0f * period)
+			size <<= 1;
+		pc.size = size;
+		pc.fillPos = 0;
+		pc.state = kCacheFilling;
+	}
 }
 
-// Read from the window table bank with bilinear morphing.
-// Same as readTableMorph but clamped to kNumWindows.
-static inline float readWindowMorph(const float tables[][kTableSize], float index, float phase)
+// Render the next count points of a filling cache: the formant sum
+// (mask and pan applied, before normalisation and envelope) at master phase
+// j / size, with the current pulsaret and every overlapping tail.
+// Each point is the live render at that phase with a step of
+// 1 / size per point.
+static void fillPeriodCache(const _pulsarAlgorithm* pThis, _periodCache& pc, float* dstL, float* dstR, int count)
 {
-	int idx0 = (int)index;
-	float frac = index - idx0;
-	if (idx0 < 0) { idx0 = 0; frac = 0.0f; }
-	if (idx0 >= kNumWindows - 1) { idx0 = kNumWindows - 2; frac = 1.0f; }
-	float s0 = readTableLerp(tables[idx0], kTableSize, phase);
-	float s1 = readTableLerp(tables[idx0 + 1], kTableSize, phase);
-	return s0 + frac * (s1 - s0);
-}
+	const _voiceSnapshot& vs = pc.snap;
+	float step = 1.0f / (float)pc.size;
+	int start = pc.fillPos;
+	int end = start + count;
+	if (end > pc.size) end = pc.size;
 
-// Fast Padé approximation of tanh for soft clipping.
-// tanh(x) ≈ x(27+x²)/(27+9x²), accurate to <1% for |x| < 3.
-static inline float fastTanh(float x)
-{
-	float x2 = x * x;
-	return x * (27.0f + x2) / (27.0f + 9.0f * x2);
-}
+	for (int j = start; j < end; ++j)
+	{
+		float phase = (float)j * step;
+		bool resync = (j == 0);
+		float sumL = 0.0f;
+		float sumR = 0.0f;
+		for (int f = 0; f < vs.formantCount; ++f)
+		{
+			for (int k = 0; k <= kMaxTails; ++k)
+			{
+				_pulsaretRotor& rot = pc.rot[f][k];
+				float age = phase + (float)k;
+				if (age >= pc.duty[f])
+				{
+					rot.valid = 0;
+					continue;
+				}
+				float pulsaretPhase = age * pc.invDuty[f];
+				float gliss = glissonMul(rot, vs.glissCurve, vs.glissDepth[f], age, step,
+				                         pc.duty[f], pulsaretPhase, resync, false);
+				float s = renderPulsaret(pThis, vs, rot, pulsaretPhase, gliss,
+				                         pc.ratio[f], step * pc.invDuty[f], resync, pc.mip[f], 0.0f);
+				s *= pc.mask[f] * pc.atten[f];
+				sumL += s * vs.panL[f];
+				sumR += s * vs.panR[f];
+			}
+		}
+		dstL[j] = sumL;
+		dstR[j] = sumR;
+	}
 
-// Fast exp2 approximation for 1V/oct pitch CV processing.
-// Uses integer bit manipulation + cubic polynomial refinement.
-// Accurate to ~1 cent over [-4, 4] range (±4 octaves).
-static inline float fastExp2f(float x)
-{
-	float fi = floorf(x);
-	float f = x - fi;
-	// Cubic polynomial for 2^f on [0,1)
-	float p = f * (f * (f * 0.079441f + 0.227411f) + 0.693147f) + 1.0f;
-	// Apply integer part by adding to IEEE 754 exponent bits
-	union { float fv; int32_t iv; } u;
-	u.fv = p;
-	u.iv += (int32_t)fi << 23;
-	return u.fv;
+	pc.fillPos = end;
+	if (end == pc.size)
+		pc.state = kCachePlaying;
 }
 
 // ============================================================
@@ -1322,7 +3497,6 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 
 	_pulsarAlgorithm* pThis = static_cast<_pulsarAlgorithm*>(self);
 	_pulsarDTC* dtc = pThis->dtc;
-	_pulsarDRAM* dram = pThis->dram;
 
 	int numFrames = numFramesBy4 * 4;
 	if (numFrames < 1) return;
@@ -1333,7 +3507,8 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 
 	// CV mode always uses all 4 voices for overlapping triggers
 	bool cvMode = (pThis->v[kParamGateMode] == 2);
-	if (cvMode) voiceCount = kMaxVoices;
+	bool polyMode = (pThis->v[kParamGateMode] == 3);
+	if (cvMode || polyMode) voiceCount = kMaxVoices;
 
 	// Free Run: ensure voice state is correct every block
 	bool freeRunMode = (pThis->v[kParamGateMode] == 1);
@@ -1345,12 +3520,8 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 			voice.gate = true;
 			// envTarget managed per-sample for per-pulse AR envelope
 			voice.velocity = 127;
-			if (voice.targetFundamentalHz <= 0.0f)
-			{
-				float hz = pThis->basePitchHz * chordRatios[chordType][v];
-				voice.targetFundamentalHz = hz;
-				voice.fundamentalHz = hz;
-			}
+			if (voice.fundamentalHz <= 0.0f)
+				setTargetPitch(pThis, voice, chordPitchOct(pThis, chordType, v));
 		}
 	}
 
@@ -1444,6 +3615,18 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 	float* cvAmpJitter = NULL;
 	float* cvTimingJitter = NULL;
 	float* cvGlisson = NULL;
+	float* cvPulsaretY = NULL;
+	float* cvHarmTilt = NULL;
+	float* cvVowel = NULL;
+	float* cvVoiceType = NULL;
+	if (pThis->v[kParamVowelCV] > 0)
+		cvVowel = busFrames + (pThis->v[kParamVowelCV] - 1) * numFrames;
+	if (pThis->v[kParamVoiceTypeCV] > 0)
+		cvVoiceType = busFrames + (pThis->v[kParamVoiceTypeCV] - 1) * numFrames;
+	if (pThis->v[kParamHarmTiltCV] > 0)
+		cvHarmTilt = busFrames + (pThis->v[kParamHarmTiltCV] - 1) * numFrames;
+	if (pThis->v[kParamPulsaretYCV] > 0)
+		cvPulsaretY = busFrames + (pThis->v[kParamPulsaretYCV] - 1) * numFrames;
 	if (pThis->v[kParamAmpJitterCV] > 0)
 		cvAmpJitter = busFrames + (pThis->v[kParamAmpJitterCV] - 1) * numFrames;
 	if (pThis->v[kParamTimingJitterCV] > 0)
@@ -1451,11 +3634,95 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 	if (pThis->v[kParamGlissonCV] > 0)
 		cvGlisson = busFrames + (pThis->v[kParamGlissonCV] - 1) * numFrames;
 
+	// Through-zero FM: the rate scales by 1 + depth·V per sample, so
+	// it runs backwards wherever depth·V < -1
+	float* busFM = NULL;
+	float fmDepth = pThis->v[kParamFMIndex] * (0.01f / 5.0f);
+	if (pThis->v[kParamFMInput] > 0 && fmDepth > 0.0f)
+		busFM = busFrames + (pThis->v[kParamFMInput] - 1) * numFrames;
+
+	// Hard sync: one pass over the sync bus finds its rising zero
+	// crossings before any voice runs. Each edge keeps its sample index
+	// and how far past the crossing that sample lies (0–1 samples, by
+	// linear interpolation), so resets land between samples.
+	int syncCount = 0;
+	int syncIdx[kMaxSyncEdges];
+	float syncElapsed[kMaxSyncEdges];
+	bool syncOn = pThis->v[kParamSyncInput] > 0;
+	if (syncOn)
+	{
+		const float* busSync = busFrames + (pThis->v[kParamSyncInput] - 1) * numFrames;
+		float prev = dtc->syncPrev;
+		for (int i = 0; i < numFrames; ++i)
+		{
+			float cur = busSync[i];
+			if (prev <= 0.0f && cur > 0.0f && syncCount < kMaxSyncEdges)
+			{
+				syncIdx[syncCount] = i;
+				syncElapsed[syncCount] = cur / (cur - prev);
+				++syncCount;
+			}
+			prev = cur;
+		}
+		dtc->syncPrev = prev;
+	}
+	int syncNext = 0;
+
 	// CV Voice gate bus pointer
 	float* cvGate = NULL;
 	if (cvMode && pThis->v[kParamGateCV] > 0)
 		cvGate = busFrames + (pThis->v[kParamGateCV] - 1) * numFrames;
 
+	// Poly CV: voice v follows gate/pitch pair v (pair 0 is Gate CV and
+	// Pitch CV). One pass over all gate busses collects the block's
+	// edges in sample order, so the sample loop only compares an index.
+	// Held voices follow their pitch bus once per block, at the tick.
+	const float* polyPitch[kMaxVoices] = { NULL, NULL, NULL, NULL };
+	int polyEdgeCount = 0;
+	uint16_t polyEdgeIdx[kMaxPolyEdges];
+	uint8_t polyEdgeVoice[kMaxPolyEdges];   // Voice number, 0x80 set for a rising edge
+	if (polyMode)
+	{
+		const float* polyGate[kMaxVoices] = { NULL, NULL, NULL, NULL };
+		polyPitch[0] = cvPitch;
+		if (pThis->v[kParamGateCV] > 0)
+			polyGate[0] = busFrames + (pThis->v[kParamGateCV] - 1) * numFrames;
+		for (int v = 1; v < kMaxVoices; ++v)
+		{
+			int gateBus = pThis->v[kParamGate2CV + 2 * (v - 1)];
+			int pitchBus = pThis->v[kParamPitch2CV + 2 * (v - 1)];
+			if (gateBus > 0)
+				polyGate[v] = busFrames + (gateBus - 1) * numFrames;
+			if (pitchBus > 0)
+				polyPitch[v] = busFrames + (pitchBus - 1) * numFrames;
+		}
+
+		uint8_t gates = dtc->polyGates;
+		for (int i = 0; i < numFrames && polyEdgeCount < kMaxPolyEdges; ++i)
+		{
+			for (int v = 0; v < kMaxVoices; ++v)
+			{
+				if (!polyGate[v])
+					continue;
+				uint8_t bit = (uint8_t)(1u << v);
+				bool high = polyGate[v][i] > 2.5f;
+				if (high != ((gates & bit) != 0) && polyEdgeCount < kMaxPolyEdges)
+				{
+					polyEdgeIdx[polyEdgeCount] = (uint16_t)i;
+					polyEdgeVoice[polyEdgeCount] = (uint8_t)(v | (high ? 0x80 : 0));
+					++polyEdgeCount;
+					gates ^= bit;
+				}
+			}
+		}
+		dtc->polyGates = gates;
+
+		for (int v = 0; v < kMaxVoices; ++v)
+			if (dtc->voices[v].gate && polyPitch[v])
+				dtc->voices[v].targetOct = pThis->basePitchOct + polyPitch[v][numFrames - 1];
+	}
+	int polyNext = 0;
+
 	// SD card mount detection
 	bool cardMounted = NT_isSdCardMounted();
 	if (pThis->cardMounted != cardMounted)
@@ -1483,6 +3750,10 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 	int burstOff = pThis->burstOff;
 	int useSample = pThis->useSample;
 	float sampleRateRatio = pThis->sampleRateRatio;
+	int latchMode = pThis->latchMode;
+
+	// Advance any pending working-window rebuild by one slice
+	buildWindowChunk(pThis);
 
 	// Read per-block CV averages (single combined loop)
 	float cvDutyAvg = 0.0f;
@@ -1499,6 +3770,10 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 	float cvAmpJitterAvg = 0.0f;
 	float cvTimingJitterAvg = 0.0f;
 	float cvGlissonAvg = 0.0f;
+	float cvPulsaretYAvg = 0.0f;
+	float cvHarmTiltAvg = 0.0f;
+	float cvVowelAvg = 0.0f;
+	float cvVoiceTypeAvg = 0.0f;
 	{
 		for (int i = 0; i < numFrames; ++i)
 		{
@@ -1516,6 +3791,10 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 			if (cvAmpJitter) cvAmpJitterAvg += cvAmpJitter[i];
 			if (cvTimingJitter) cvTimingJitterAvg += cvTimingJitter[i];
 			if (cvGlisson) cvGlissonAvg += cvGlisson[i];
+			if (cvPulsaretY) cvPulsaretYAvg += cvPulsaretY[i];
+			if (cvHarmTilt) cvHarmTiltAvg += cvHarmTilt[i];
+			if (cvVowel) cvVowelAvg += cvVowel[i];
+			if (cvVoiceType) cvVoiceTypeAvg += cvVoiceType[i];
 		}
 		float invNumFrames = 1.0f / (float)numFrames;
 		if (cvDuty) cvDutyAvg *= invNumFrames;
@@ -1532,6 +3811,10 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 		if (cvAmpJitter) cvAmpJitterAvg *= invNumFrames;
 		if (cvTimingJitter) cvTimingJitterAvg *= invNumFrames;
 		if (cvGlisson) cvGlissonAvg *= invNumFrames;
+		if (cvPulsaretY) cvPulsaretYAvg *= invNumFrames;
+		if (cvHarmTilt) cvHarmTiltAvg *= invNumFrames;
+		if (cvVowel) cvVowelAvg *= invNumFrames;
+		if (cvVoiceType) cvVoiceTypeAvg *= invNumFrames;
 	}
 
 	// Duty CV: bipolar ±5V → ±20% offset
@@ -1547,27 +3830,77 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 	if (pulsaretIdx < 0.0f) pulsaretIdx = 0.0f;
 	if (pulsaretIdx > 9.0f) pulsaretIdx = 9.0f;
 
+	// Pulsaret Y CV: bipolar ±5V → ±100% offset on the tilt axis. Off
+	// the centre row the X/Y blend is resolved into the working table.
+	float pulsaretY = pThis->pulsaretY + cvPulsaretYAvg * 0.2f;
+	if (pulsaretY < -1.0f) pulsaretY = -1.0f;
+	if (pulsaretY > 1.0f) pulsaretY = 1.0f;
+	buildPulsaretChunk(pThis, pulsaretIdx, pulsaretY);
+	bool pulsaretWork = (pulsaretY != 0.0f && pThis->pulsaretWorkValid);
+	pThis->displayPulsaretWork = pulsaretWork;
+
+	// Harm Tilt CV: bipolar ±5V → ±6 dB/oct on the additive spectrum
+	float harmTilt = pThis->harmTilt + cvHarmTiltAvg * 1.2f;
+	if (harmTilt < -12.0f) harmTilt = -12.0f;
+	if (harmTilt > 12.0f) harmTilt = 12.0f;
+	buildAdditiveChunk(pThis, harmTilt);
+	bool additive = (pThis->additive && pThis->additiveValid);
+	pThis->displayAdditive = additive;
+
+	// Live noise replaces the fixed noise table whenever the pulsaret
+	// index reaches into the noise slot (pulse → noise morph)
+	bool liveNoise = (pThis->noiseType != kNoiseTable && pulsaretIdx > (float)(kNumPulsarets - 2)
+	                  && !additive && !pulsaretWork);
+
 	// Window CV: bipolar ±5V → ±2.0 offset on index (full range sweep)
 	windowIdx += cvWindowAvg * 0.4f;
 	if (windowIdx < 0.0f) windowIdx = 0.0f;
 	if (windowIdx > 4.0f) windowIdx = 4.0f;
 
+	// Window evaluation path: closed forms when the index sits exactly
+	// on a rectangular, Hann or linear-decay table (no morph)
+	int windowPath = kWindowPathMorph;
+	if (pThis->windowType != 0) windowPath = kWindowPathWork;
+	else if (windowIdx == 0.0f) windowPath = kWindowPathRect;
+	else if (windowIdx == 2.0f) windowPath = kWindowPathHann;
+	else if (windowIdx == 4.0f) windowPath = kWindowPathLinear;
+
 	// Amplitude CV: bipolar ±5V → ±50% offset on amplitude
 	float effectiveAmplitude = amplitude + cvAmplitudeAvg * 0.1f;
 	if (effectiveAmplitude < 0.0f) effectiveAmplitude = 0.0f;
 	if (effectiveAmplitude > 2.0f) effectiveAmplitude = 2.0f;
 
-	// Formant 1-3 CV: bipolar ±5V → ±1000 Hz offset, clamped to [20, 2000]
+	// Vowel plane: Vowel CV ±5V → ±2.0 (A–U), Voice Type CV ±5V → ±1.5
+	// (Bass–Soprano). Replaces the Formant Hz params when on.
+	float baseFormantHz[3] = { pThis->formantHz[0], pThis->formantHz[1], pThis->formantHz[2] };
+	if (pThis->vowelMode)
+	{
+		float vowel = pThis->vowel + cvVowelAvg * 0.4f;
+		if (vowel < 0.0f) vowel = 0.0f;
+		if (vowel > (float)(kNumVowels - 1)) vowel = (float)(kNumVowels - 1);
+		float voiceType = pThis->voiceType + cvVoiceTypeAvg * 0.3f;
+		if (voiceType < 0.0f) voiceType = 0.0f;
+		if (voiceType > (float)(kNumVoiceTypes - 1)) voiceType = (float)(kNumVoiceTypes - 1);
+		vowelFormants(vowel, voiceType, baseFormantHz);
+	}
+
+	// Formant 1-3 CV: bipolar ±5V → ±1000 Hz offset (Linear) or ±5
+	// octaves (1V/Oct), clamped to [20, kFormantMaxHz]
 	float modulatedFormantHz[3];
-	modulatedFormantHz[0] = pThis->formantHz[0] + cvFormant1Avg * 200.0f;
-	if (modulatedFormantHz[0] < 20.0f) modulatedFormantHz[0] = 20.0f;
-	if (modulatedFormantHz[0] > 2000.0f) modulatedFormantHz[0] = 2000.0f;
-	modulatedFormantHz[1] = pThis->formantHz[1] + cvFormant2Avg * 200.0f;
-	if (modulatedFormantHz[1] < 20.0f) modulatedFormantHz[1] = 20.0f;
-	if (modulatedFormantHz[1] > 2000.0f) modulatedFormantHz[1] = 2000.0f;
-	modulatedFormantHz[2] = pThis->formantHz[2] + cvFormant3Avg * 200.0f;
-	if (modulatedFormantHz[2] < 20.0f) modulatedFormantHz[2] = 20.0f;
-	if (modulatedFormantHz[2] > 2000.0f) modulatedFormantHz[2] = 2000.0f;
+	float cvFormantAvg[3] = { cvFormant1Avg, cvFormant2Avg, cvFormant3Avg };
+	for (int f = 0; f < 3; ++f)
+	{
+		float hz = pThis->formantCVMode ? baseFormantHz[f] * fastExp2f(cvFormantAvg[f])
+		                                : baseFormantHz[f] + cvFormantAvg[f] * 200.0f;
+		if (hz < 20.0f) hz = 20.0f;
+		if (hz > kFormantMaxHz) hz = kFormantMaxHz;
+		modulatedFormantHz[f] = hz;
+	}
+
+	// Formant Track in the log domain: octaves of pitch above the
+	// centre key, scaled by the amount, back to a multiplier per voice
+	float trackCentreOct = fastLog2f(pThis->basePitchHz) + (float)pThis->trackCentre * (1.0f / 12.0f);
+	float trackAmount = pThis->trackAmount;
 
 	// Attack CV: bipolar ±5V → ±1000 ms offset on attack time
 	float modulatedAttackCoeff = dtc->voices[0].attackCoeff;
@@ -1604,12 +3937,16 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 	if (effectiveGlisson < -2.0f) effectiveGlisson = -2.0f;
 	if (effectiveGlisson > 2.0f) effectiveGlisson = 2.0f;
 
+	// Sine-family pulsarets without glisson run table-free: one
+	// quadrature oscillator per pulsaret yields sin, sin×2 and sin×3
+	bool sinePath = (pulsaretIdx <= 2.0f && effectiveGlisson == 0.0f && !pulsaretWork && !additive);
+
 	// Update display state for draw() — reflects CV modulation in realtime
 	pThis->displayPulsaretIdx = pulsaretIdx;
 	pThis->displayWindowIdx = windowIdx;
 	float effDuty = baseDuty + dutyCvOffset;
 	if (effDuty < 0.01f) effDuty = 0.01f;
-	if (effDuty > 1.0f) effDuty = 1.0f;
+	if (effDuty > kMaxDuty) effDuty = kMaxDuty;
 	pThis->displayDuty = effDuty;
 	pThis->displayFormantHz[0] = modulatedFormantHz[0];
 	pThis->displayFormantHz[1] = modulatedFormantHz[1];
@@ -1618,7 +3955,7 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 	pThis->displayMask = effectiveMask;
 
 	// Precompute per-formant pan gains (always compute all 3 for snapshots)
-	float panL[3], panR[3];
+	float panPos[3], panL[3], panR[3];
 	for (int f = 0; f < 3; ++f)
 	{
 		float p = pThis->pan[f];
@@ -1629,6 +3966,7 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 			if (p < -1.0f) p = -1.0f;
 			if (p > 1.0f) p = 1.0f;
 		}
+		panPos[f] = p;
 		float angle = (p + 1.0f) * 0.25f * (float)M_PI; // 0..pi/2
 		panL[f] = cosf(angle);
 		panR[f] = sinf(angle);
@@ -1640,13 +3978,75 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 	{
 		manualDuty[f] = baseDuty + dutyCvOffset;
 		if (manualDuty[f] < 0.01f) manualDuty[f] = 0.01f;
-		if (manualDuty[f] > 1.0f) manualDuty[f] = 1.0f;
+		if (manualDuty[f] > kMaxDuty) manualDuty[f] = kMaxDuty;
 	}
 
+	// Period cache: voices can only settle into an exact period with no
+	// per-pulse randomness, no sequencer lanes, no live noise and no
+	// working table being rebuilt or sample being loaded (and only when
+	// the cache tables were requested)
+	bool cacheable = (effectiveTimingJitter == 0.0f && maskMode == 0 && !liveNoise
+	                  && pThis->windowBuildPos < 0 && !(pThis->windowDirty && pThis->windowType != 0)
+	                  && pThis->pulsaretBuildPos < 0
+	                  && pThis->additiveBuildPos < 0 && !(pThis->additiveDirty && pThis->additive)
+	                  && !pThis->awaitingCallback && !busFM && !syncOn && pThis->periodCacheTables);
+	for (int lane = 0; lane < kNumLanes; ++lane)
+		if (pThis->seqLength[lane] > 0)
+			cacheable = false;
+
 	float invFormantCount = 1.0f / (float)formantCount;
 	float invSr = 1.0f / sr;
 	float invVoiceCount = 1.0f / (float)voiceCount;
 
+	// Chord Lock: in Free Run, an Octaves, Fifths or Sub+Oct chord takes
+	// every voice's phase from one 32-bit counter times its whole
+	// multiple, so the voices stay locked indefinitely. Voice 0 keeps its
+	// pitch tick, jitter and FM and drives the counter; the others skip
+	// their own glide and accumulator.
+	bool lockOn = freeRunMode && pThis->v[kParamChordLock] && voiceCount > 1
+	              && chordType > 0 && chordType < kNumRatioChords;
+	const uint8_t* lockMul = lockOn ? kLockMul[chordType] : NULL;
+	if (lockOn && !dtc->lockActive)
+	{
+		// Seat the counter on voice 0 and the others' phases on it, so
+		// the first locked sample doesn't read as a wrap
+		dtc->lockPhase = (uint32_t)(uint64_t)(dtc->voices[0].masterPhase / lockMul[0] * 4294967296.0);
+		for (int v = 1; v < voiceCount; ++v)
+		{
+			dtc->voices[v].masterPhase = (float)(dtc->lockPhase * lockMul[v]) * (1.0f / 4294967296.0f);
+			for (int f = 0; f < 3; ++f)
+				dtc->voices[v].rot[f].valid = 0;
+		}
+	}
+	else if (!lockOn && dtc->lockActive)
+	{
+		// Unlocked voices restart their own pitch ticks where they are.
+		// Their pitch state went stale while locked, so seat it on the
+		// pitch they were playing: voice 0's times their chord multiple.
+		const uint8_t* lastMul = kLockMul[dtc->lockChord];
+		const _pulsarVoice& master = dtc->voices[0];
+		for (int v = 1; v < kMaxVoices; ++v)
+		{
+			_pulsarVoice& voice = dtc->voices[v];
+			if (v < dtc->lockVoices)
+			{
+				float oct = log2f((float)lastMul[v] / (float)lastMul[0]);
+				voice.pitchOct = master.pitchOct + oct;
+				voice.tickOct = master.tickOct + oct;
+				voice.fundamentalHz = exp2f(voice.pitchOct);
+			}
+			voice.pitchJump = true;
+		}
+	}
+	dtc->lockActive = lockOn;
+	if (lockOn)
+	{
+		dtc->lockChord = (uint8_t)chordType;
+		dtc->lockVoices = (uint8_t)voiceCount;
+	}
+	float lockBaseInc = 0.0f;   // Master counter rate without jitter/FM, per sample
+	float lockInc = 0.0f;       // Master counter rate this sample
+
 	float peak = 0.0f;
 	int activeVoices = 0;
 
@@ -1658,6 +4058,30 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 		bool voice0Pulse = false;
 		float maxEnvSample = 0.0f;
 
+		bool syncNow = (syncNext < syncCount && syncIdx[syncNext] == i);
+		float syncFrac = syncNow ? syncElapsed[syncNext++] : 0.0f;
+
+		// Poly CV edges due at this sample
+		for (; polyNext < polyEdgeCount && polyEdgeIdx[polyNext] == i; ++polyNext)
+		{
+			int v = polyEdgeVoice[polyNext] & 0x7f;
+			_pulsarVoice& voice = dtc->voices[v];
+			if (polyEdgeVoice[polyNext] & 0x80)
+			{
+				startVoiceNote(pThis, voice, v, kMaxVoices);
+				voice.gate = true;
+				voice.envTarget = 1.0f;
+				voice.velocity = 127;
+				setTargetPitch(pThis, voice, pThis->basePitchOct + (polyPitch[v] ? polyPitch[v][i] : 0.0f));
+				resetSeqLanes(voice);
+			}
+			else
+			{
+				voice.gate = false;
+				voice.envTarget = 0.0f;
+			}
+		}
+
 		// CV gate+pitch voice triggering (per-sample edge detection)
 		if (cvMode && cvGate)
 		{
@@ -1697,15 +4121,12 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 
 				// Assign to chosen voice
 				_pulsarVoice& voice = dtc->voices[chosen];
+				startVoiceNote(pThis, voice, chosen, voiceCount);
 				voice.gate = true;
 				voice.envTarget = 1.0f;
 				voice.velocity = 127;
-				float pitchHz = pThis->basePitchHz;
-				if (cvPitch)
-					pitchHz *= fastExp2f(cvPitch[i]);
-				voice.targetFundamentalHz = pitchHz;
-				if (pThis->glideMs <= 0.0f || voice.fundamentalHz <= 0.0f)
-					voice.fundamentalHz = pitchHz;
+				setTargetPitch(pThis, voice, pThis->basePitchOct + (cvPitch ? cvPitch[i] : 0.0f));
+				resetSeqLanes(voice);
 				dtc->voiceAge[chosen] = dtc->nextVoiceAge++;
 				dtc->activeVoiceIdx = (int8_t)chosen;
 			}
@@ -1713,10 +4134,7 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 			{
 				// Gate held: active voice tracks pitch CV
 				if (cvPitch)
-				{
-					float pitchHz = pThis->basePitchHz * fastExp2f(cvPitch[i]);
-					dtc->voices[dtc->activeVoiceIdx].targetFundamentalHz = pitchHz;
-				}
+					dtc->voices[dtc->activeVoiceIdx].targetOct = pThis->basePitchOct + cvPitch[i];
 			}
 			else if (!gateHigh && dtc->prevGateHigh)
 			{
@@ -1743,9 +4161,172 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 			// Track active voices (only on first sample for display)
 			if (i == 0) ++activeVoices;
 
+			// Pitch tick, in octaves: glide the remaining samples of the
+			// block in one step, add the pitch CV (volts = octaves) at the
+			// block end, and ramp the phase increment geometrically there.
+			// In CV mode, pitch is captured per-voice at gate trigger
+			// (releasing voices keep their pitch); in other modes pitch CV
+			// shifts all voices together.
+			bool locked = lockOn && vi > 0;
+			if (!locked && (i == 0 || voice.pitchTick))
+			{
+				int n = numFrames - i;
+				float cvOct = (cvPitch && !cvMode && !polyMode) ? cvPitch[numFrames - 1] : 0.0f;
+				// A mid-block re-tick that doesn't jump ramps on from the
+				// rate reached so far, not from the end of the old ramp
+				bool jump = voice.pitchJump || voice.phaseIncBase <= 0.0f;
+				float octStart;
+				if (jump || i == 0)
+				{
+					octStart = jump ? voice.pitchOct + cvOct : voice.tickOct;
+					voice.phaseIncBase = exp2f(octStart) * invSr;
+				}
+				else
+				{
+					octStart = log2f(voice.phaseIncBase * sr);
+				}
+				float glide = (voice.glideCoeff > 0.0f) ? powf(voice.glideCoeff, (float)n) : 0.0f;
+				voice.pitchOct = voice.targetOct + glide * (voice.pitchOct - voice.targetOct);
+				voice.tickOct = voice.pitchOct + cvOct;
+				voice.phaseIncStep = (voice.tickOct != octStart) ? exp2f((voice.tickOct - octStart) / (float)n) : 1.0f;
+				voice.fundamentalHz = exp2f(voice.pitchOct);
+				voice.pitchTick = false;
+				voice.pitchJump = false;
+			}
+			float freqHz;
+			float phaseInc;
+			if (locked)
+			{
+				freqHz = lockBaseInc * lockMul[vi] * sr;
+				phaseInc = lockInc * lockMul[vi];
+				if (phaseInc < -0.5f) phaseInc = -0.5f;
+				if (phaseInc > 0.5f) phaseInc = 0.5f;
+			}
+			else
+			{
+				voice.phaseIncBase *= voice.phaseIncStep;
+				freqHz = voice.phaseIncBase * sr;
+
+				phaseInc = voice.phaseIncBase * voice.phaseIncMult; // Timing jitter
+				if (busFM)
+					phaseInc += phaseInc * fmDepth * busFM[i];
+				if (phaseInc < -0.5f) phaseInc = -0.5f;
+				if (phaseInc > 0.5f) phaseInc = 0.5f;
+			}
+
+			// Advance master phase
+			if (lockOn)
+			{
+				if (vi == 0)
+				{
+					float invMul = 1.0f / (float)lockMul[0];
+					lockBaseInc = voice.phaseIncBase * invMul;
+					lockInc = phaseInc * invMul;
+					if (syncNow)
+					{
+						uint32_t elapsed = (uint32_t)(syncFrac * fabsf(lockInc) * 4294967296.0f);
+						dtc->lockPhase = (lockInc < 0.0f) ? 0u - elapsed : elapsed;
+					}
+					else
+						dtc->lockPhase += (uint32_t)(int64_t)(lockInc * 4294967296.0f);
+				}
+				// Whole multiples wrap exactly in 32 bits; the wrap test
+				// below sees the phase pushed past 1 (or 0 backwards)
+				float phase = (float)(dtc->lockPhase * lockMul[vi]) * (1.0f / 4294967296.0f);
+				if (phaseInc >= 0.0f && phase < voice.masterPhase)
+					phase += 1.0f;
+				else if (phaseInc < 0.0f && phase > voice.masterPhase)
+					phase -= 1.0f;
+				voice.masterPhase = phase;
+			}
+			else
+			{
+				voice.masterPhase += phaseInc;
+			}
+
+			// Age overlapping tails, retiring those whose window has ended
+			if (voice.activeTails)
+			{
+				for (int f = 0; f < 3; ++f)
+				{
+					for (int t = 0; t < kMaxTails; ++t)
+					{
+						_pulsaretTail& tail = voice.tails[f][t];
+						if (tail.age >= tail.duty)
+							continue;
+						tail.age += fabsf(phaseInc);
+						if (tail.age >= tail.duty)
+							--voice.activeTails;
+					}
+				}
+			}
+
+			// Detect new pulse trigger: hard sync, else phase wrap
+			bool newPulse = false;
+			if (syncNow)
+			{
+				// Restart the period at the crossing; the sounding
+				// pulsaret is cut, as in oscillator hard sync. Running
+				// backwards under FM, the period restarts from its end, so
+				// the next reverse wrap is a period away, not one sample.
+				float elapsed = syncFrac * fabsf(phaseInc);
+				voice.masterPhase = (phaseInc < 0.0f) ? 1.0f - elapsed : elapsed;
+				newPulse = true;
+				advanceSeqLanes(pThis, voice);
+			}
+			else if (voice.masterPhase >= 1.0f)
+			{
+				voice.masterPhase -= 1.0f;
+				newPulse = true;
+				advanceSeqLanes(pThis, voice);
+
+				// Pulsarets longer than one period carry on as tails
+				// (oldest tail is recycled if all slots are busy); a
+				// forced restart cuts the pulsaret instead
+				int tailFormants = voice.phaseRestart ? 0 : voice.snap.formantCount;
+				for (int f = 0; f < tailFormants; ++f)
+				{
+					if (voice.masterPhase + 1.0f >= voice.formantDuty[f])
+						continue;
+					int slot = 0;
+					for (int t = 0; t < kMaxTails; ++t)
+					{
+						const _pulsaretTail& tail = voice.tails[f][t];
+						if (tail.age >= tail.duty) { slot = t; break; }
+						if (tail.age > voice.tails[f][slot].age) slot = t;
+					}
+					_pulsaretTail& tail = voice.tails[f][slot];
+					if (tail.age >= tail.duty)
+						++voice.activeTails;
+					tail.age = voice.masterPhase + 1.0f;
+					tail.duty = voice.formantDuty[f];
+					tail.invDuty = voice.formantInvDuty[f];
+					tail.ratio = voice.formantRatio[f];
+					tail.mask = voice.maskSmooth[f] * voice.formantAtten[f];
+					tail.mip = voice.formantMip[f];
+					tail.rot = voice.rot[f];
+				}
+			}
+			else if (voice.masterPhase < 0.0f)
+			{
+				// Running backwards under FM: the reverse wrap is a pulse
+				// too. The pulsaret just played in reverse, so no tail.
+				voice.masterPhase += 1.0f;
+				newPulse = true;
+				advanceSeqLanes(pThis, voice);
+			}
+			if (newPulse)
+				voice.phaseRestart = false;
+
 			// Update snapshot while voice is gated; freeze on release
-			// so releasing voices maintain their timbral state
-			if (voice.gate)
+			// so releasing voices maintain their timbral state.
+			// Pulse latch: only pick up changes at pulse boundaries so each
+			// pulsaret renders with one consistent parameter set. A snapshot
+			// that was never filled (formantCount 0) or belongs to the
+			// previous note is latched immediately.
+			bool latchNow = !latchMode || newPulse || voice.forceLatch || voice.snap.formantCount == 0;
+			voice.forceLatch = false;
+			if (voice.gate && latchNow)
 			{
 				voice.snap.pulsaretIdx = pulsaretIdx;
 				voice.snap.windowIdx = windowIdx;
@@ -1761,51 +4342,142 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 				voice.snap.amplitude = effectiveAmplitude;
 				voice.snap.useSample = useSample;
 				voice.snap.sampleRateRatio = sampleRateRatio;
-				voice.snap.glissonDepth = effectiveGlisson;
+				for (int f = 0; f < 3; ++f)
+					voice.snap.glissDepth[f] = effectiveGlisson * pThis->glissScale[f];
+				voice.snap.glissCurve = pThis->glissCurve;
 				voice.snap.ampJitterAmount = effectiveAmpJitter;
 				voice.snap.timingJitterAmount = effectiveTimingJitter;
 				voice.snap.perFormantMask = (pThis->perFormantMask != 0);
+				voice.snap.windowPath = windowPath;
+				voice.snap.sinePath = sinePath;
+				voice.snap.pulsaretWork = pulsaretWork;
+				voice.snap.workFront[kWorkWindow] = (uint8_t)pThis->windowWorkFront;
+				voice.snap.workFront[kWorkPulsaret] = (uint8_t)pThis->pulsaretWorkFront;
+				voice.snap.workFront[kWorkAdditive] = (uint8_t)pThis->additiveWorkFront;
+				voice.snap.additive = additive;
+				voice.snap.noiseType = pThis->noiseType;
+				voice.snap.liveNoise = liveNoise;
 				voice.snap.formantTrack = (pThis->formantTrack != 0);
+				voice.snap.harmLock = (pThis->harmLock != 0);
 				for (int f = 0; f < 3; ++f)
 				{
 					voice.snap.manualDuty[f] = manualDuty[f];
 					voice.snap.formantHz[f] = modulatedFormantHz[f];
+					voice.snap.pan[f] = panPos[f];
 					voice.snap.panL[f] = panL[f];
 					voice.snap.panR[f] = panR[f];
 				}
 			}
 			_voiceSnapshot& vs = voice.snap;
 
-			// Glide: one-pole lag on frequency
-			float glideC = voice.glideCoeff;
-			voice.fundamentalHz = voice.targetFundamentalHz + glideC * (voice.fundamentalHz - voice.targetFundamentalHz);
-
-			// Per-sample pitch CV (1V/oct)
-			// In CV mode, pitch is captured per-voice at gate trigger (releasing voices keep their pitch)
-			// In other modes, pitch CV shifts all voices proportionally
-			float freqHz = voice.fundamentalHz;
-			if (cvPitch && !cvMode)
-				freqHz *= fastExp2f(cvPitch[i]);
-
-			// Advance master phase
-			float phaseInc = freqHz * invSr;
-			phaseInc *= voice.phaseIncMult; // Timing jitter
-			if (phaseInc < 0.0f) phaseInc = 0.0f;
-			if (phaseInc > 0.5f) phaseInc = 0.5f;
+			// Formant Track multiplier, once per block and per pulse (and
+			// when a voice starts mid-block)
+			if (vs.formantTrack && (i == 0 || newPulse || voice.formantTrackMul <= 0.0f))
+			{
+				float oct = fastLog2f(freqHz > 0.1f ? freqHz : 0.1f) - trackCentreOct;
+				voice.formantTrackMul = fastExp2f(trackAmount * oct);
+			}
 
-			voice.masterPhase += phaseInc;
+			// Harmonic lock: glide each locked ratio toward its target
+			// harmonic, landing exactly on the whole number
+			if (vs.harmLock)
+			{
+				float c = voice.harmGlideCoeff;
+				for (int f = 0; f < vs.formantCount; ++f)
+				{
+					float h = voice.harmTarget[f];
+					float r = h + c * (voice.harmRatio[f] - h);
+					voice.harmRatio[f] = (fabsf(r - h) < 1e-4f) ? h : r;
+				}
+			}
 
-			// Detect new pulse trigger (phase wrap)
-			bool newPulse = false;
-			if (voice.masterPhase >= 1.0f)
+			// Per-formant frequency, duty and pulsaret ratio. In block mode
+			// these follow pitch every sample; in pulse latch mode they are
+			// derived once per pulse, keeping the divisions out of the
+			// per-sample path at low fundamentals.
+			if (latchNow)
 			{
-				voice.masterPhase -= 1.0f;
-				newPulse = true;
+				float invFreqHz = 1.0f / (freqHz > 0.1f ? freqHz : 0.1f);
+				for (int f = 0; f < vs.formantCount; ++f)
+				{
+					// Effective formant frequency (with sequencer lane offset
+					// and optional pitch tracking)
+					float fHz = vs.formantHz[f] + voice.seqValue[kLaneFormant];
+					if (fHz < 20.0f) fHz = 20.0f;
+					if (fHz > kFormantMaxHz) fHz = kFormantMaxHz;
+					if (vs.formantTrack)
+						fHz *= voice.formantTrackMul;
+					float ratio = fHz * invFreqHz;
+
+					// Harmonic lock: a whole number of pulsaret cycles per
+					// period, so pulsarets end on a cycle boundary and the
+					// output repeats exactly every period
+					if (vs.harmLock)
+					{
+						float h = (float)(int)(ratio + 0.5f);
+						if (h < 1.0f) h = 1.0f;
+						voice.harmTarget[f] = h;
+						if (voice.harmRatio[f] <= 0.0f)
+							voice.harmRatio[f] = h;
+						ratio = voice.harmRatio[f];
+						fHz = ratio * freqHz;
+					}
+
+					// Compute per-voice formant duty
+					float duty;
+					if (vs.dutyMode == 1 && freqHz > 0.0f)
+					{
+						duty = freqHz / fHz;
+						if (duty > 1.0f) duty = 1.0f;
+					}
+					else
+					{
+						duty = vs.manualDuty[f];
+					}
+					duty += voice.seqValue[kLaneDuty];
+					if (duty < 0.01f) duty = 0.01f;
+					if (duty > kMaxDuty) duty = kMaxDuty;
+					voice.formantDuty[f] = duty;
+					voice.formantInvDuty[f] = 1.0f / duty;
+					voice.formantRatio[f] = ratio;
+
+					// Alias guard: the pulsaret plays fHz / duty table cycles
+					// per second. Pick the band-limited level whose harmonics
+					// fit below Nyquist at the top of an upward glisson (every
+					// curve peaks at 2^(depth × duty) as the pulsaret ends),
+					// and fade the formant out as its fundamental itself
+					// approaches Nyquist.
+					float cps = fHz * invSr * voice.formantInvDuty[f];
+					float maxGliss = (vs.glissDepth[f] > 0.0f) ? exp2f(vs.glissDepth[f] * duty) : 1.0f;
+					voice.formantMip[f] = (uint8_t)mipLevel(cps * maxGliss);
+					voice.formantAtten[f] = partialGain(cps);
+
+					// Above 100% duty about duty pulsarets overlap; scale
+					// each by 1/sqrt(duty) so their sum holds its level
+					// rather than growing with the overlap
+					if (duty > 1.0f)
+						voice.formantAtten[f] *= 1.0f / sqrtf(duty);
+				}
 			}
 
 			// On new pulse: update mask targets, amplitude jitter, timing jitter
 			if (newPulse)
 			{
+				// Pan lane: offset each formant's pan position for this pulse
+				voice.seqPanOn = (pThis->seqLength[kLanePan] > 0);
+				if (voice.seqPanOn)
+				{
+					for (int f = 0; f < vs.formantCount; ++f)
+					{
+						float p = vs.pan[f] + voice.seqValue[kLanePan];
+						if (p < -1.0f) p = -1.0f;
+						if (p > 1.0f) p = 1.0f;
+						float angle = (p + 1.0f) * 0.25f * (float)M_PI;
+						voice.seqPanL[f] = cosf(angle);
+						voice.seqPanR[f] = sinf(angle);
+					}
+				}
+
 				// Amplitude jitter
 				if (vs.ampJitterAmount > 0.0f)
 				{
@@ -1891,65 +4563,92 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 			for (int f = 0; f < vs.formantCount; ++f)
 				voice.maskSmooth[f] = voice.maskTarget[f] + maskCoeff * (voice.maskSmooth[f] - voice.maskTarget[f]);
 
+			// Live noise: Band coefficients follow the formants every
+			// kNoiseBlock samples
+			if (vs.liveNoise && vs.noiseType == kNoiseBand && ++voice.noisePos >= kNoiseBlock)
+			{
+				for (int f = 0; f < vs.formantCount; ++f)
+					setNoiseBand(voice.noiseBand[f], voice.formantRatio[f] * freqHz, invSr);
+				voice.noisePos = 0;
+			}
+
 			// Synthesis: accumulate formants
 			float sumL = 0.0f;
 			float sumR = 0.0f;
 			float phase = voice.masterPhase;
+			const float* gainL = voice.seqPanOn ? voice.seqPanL : vs.panL;
+			const float* gainR = voice.seqPanOn ? voice.seqPanR : vs.panR;
 
-			for (int f = 0; f < vs.formantCount; ++f)
+			// Period cache: key check at the start of each block and at
+			// each pulse; a full cache replaces the formant loop while the
+			// pitch holds
+			_periodCache& pc = pThis->periodCache[vi];
+			if (i == 0 || newPulse)
+				checkPeriodCache(pThis, pc, voice, phaseInc, cacheable);
+
+			if (pc.state == kCachePlaying && phaseInc == pc.phaseInc)
 			{
-				// Effective formant frequency (with optional pitch tracking)
-				float fHz = vs.formantHz[f];
-				if (vs.formantTrack)
-					fHz *= freqHz / pThis->basePitchHz;
-
-				// Compute per-voice formant duty
-				float duty;
-				if (vs.dutyMode == 1 && freqHz > 0.0f)
-				{
-					duty = freqHz / fHz;
-					if (duty > 1.0f) duty = 1.0f;
-				}
-				else
+				sumL = readTableHermite((*pThis->periodCacheTables)[vi][0], pc.size, phase);
+				sumR = readTableHermite((*pThis->periodCacheTables)[vi][1], pc.size, phase);
+				pc.played = true;
+			}
+			else
+			{
+				// Back from the cache: rotors restart exactly on their next sample
+				if (pc.played)
 				{
-					duty = vs.manualDuty[f];
+					pc.played = false;
+					for (int f = 0; f < 3; ++f)
+					{
+						voice.rot[f].valid = 0;
+						for (int t = 0; t < kMaxTails; ++t)
+							voice.tails[f][t].rot.valid = 0;
+					}
 				}
 
-				if (phase < duty)
+				for (int f = 0; f < vs.formantCount; ++f)
 				{
-					float pulsaretPhase = phase / duty;
-					float sample;
+					float duty = voice.formantDuty[f];
 
-					if (vs.useSample && pThis->sampleLoadedFrames >= 2)
+					if (phase < duty)
 					{
-						// Sample-based pulsaret
-						float samplePos = pulsaretPhase * (pThis->sampleLoadedFrames - 1) * vs.sampleRateRatio;
-						int sIdx = (int)samplePos;
-						float sFrac = samplePos - sIdx;
-						if (sIdx < 0) sIdx = 0;
-						if (sIdx >= pThis->sampleLoadedFrames - 1) sIdx = pThis->sampleLoadedFrames - 2;
-						sample = dram->sampleBuffer[sIdx] + sFrac * (dram->sampleBuffer[sIdx + 1] - dram->sampleBuffer[sIdx]);
+						float invDuty = voice.formantInvDuty[f];
+						float pulsaretPhase = phase * invDuty;
+						float gliss = glissonMul(voice.rot[f], vs.glissCurve, vs.glissDepth[f], phase, phaseInc,
+						                         duty, pulsaretPhase, newPulse, busFM != NULL);
+						float s = renderPulsaret(pThis, vs, voice.rot[f], pulsaretPhase, gliss,
+						                         voice.formantRatio[f], phaseInc * invDuty, newPulse, voice.formantMip[f],
+						                         vs.liveNoise ? nextNoise(voice.noise[f][0], vs.noiseType, voice.noiseBand[f]) : 0.0f);
+						s *= voice.maskSmooth[f] * voice.formantAtten[f];
+
+						// Pan to stereo (constant power)
+						sumL += s * gainL[f];
+						sumR += s * gainR[f];
 					}
 					else
 					{
-						// Table-based pulsaret with morphing
-						float formantRatio = fHz / (freqHz > 0.1f ? freqHz : 0.1f);
-						// Glisson: pitch sweep within pulsaret
-						if (vs.glissonDepth != 0.0f)
-							formantRatio *= fastExp2f(vs.glissonDepth * phase);
-						float tablePhase = pulsaretPhase * formantRatio;
-						tablePhase -= static_cast<float>(static_cast<int>(tablePhase));
-						sample = readTableMorph(dram->pulsaretTables, vs.pulsaretIdx, tablePhase);
+						voice.rot[f].valid = 0;
 					}
 
-					// Window with morphing
-					float window = readWindowMorph(dram->windowTables, vs.windowIdx, pulsaretPhase);
-
-					float s = sample * window * voice.maskSmooth[f];
-
-					// Pan to stereo (constant power)
-					sumL += s * vs.panL[f];
-					sumR += s * vs.panR[f];
+					// Overlapping tails of earlier pulsarets (duty > 100%)
+					if (voice.activeTails)
+					{
+						for (int t = 0; t < kMaxTails; ++t)
+						{
+							_pulsaretTail& tail = voice.tails[f][t];
+							if (tail.age >= tail.duty)
+								continue;
+							float pulsaretPhase = tail.age * tail.invDuty;
+							float gliss = glissonMul(tail.rot, vs.glissCurve, vs.glissDepth[f], tail.age, phaseInc,
+							                         tail.duty, pulsaretPhase, false, busFM != NULL);
+							float s = renderPulsaret(pThis, vs, tail.rot, pulsaretPhase, gliss,
+							                         tail.ratio, phaseInc * tail.invDuty, false, tail.mip,
+							                         vs.liveNoise ? nextNoise(voice.noise[f][1 + t], vs.noiseType, voice.noiseBand[f]) : 0.0f);
+							s *= tail.mask;
+							sumL += s * gainL[f];
+							sumR += s * gainR[f];
+						}
+					}
 				}
 			}
 
@@ -1974,7 +4673,7 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 			}
 
 			float vel = voice.velocity * (1.0f / 127.0f);
-			float gain = voice.envValue * vs.amplitude * vel * voice.ampJitter;
+			float gain = voice.envValue * vs.amplitude * vel * voice.ampJitter * voice.seqValue[kLaneAmp];
 			sumL *= gain;
 			sumR *= gain;
 
@@ -2086,6 +4785,15 @@ void step(_NT_algorithm* self, float* busFrames, int numFramesBy4)
 	pThis->peakLevel = peak;
 	pThis->displayActiveVoices = activeVoices;
 
+	// Period cache: render the next slice of each filling cache at half
+	// a point per output sample, bounding the extra load to half a voice
+	for (int v = 0; v < voiceCount; ++v)
+	{
+		_periodCache& pc = pThis->periodCache[v];
+		if (pc.state == kCacheFilling)
+			fillPeriodCache(pThis, pc, (*pThis->periodCacheTables)[v][0], (*pThis->periodCacheTables)[v][1], numFrames / 2);
+	}
+
 	// CPU load: cycles used / cycles available per block
 	// STM32H743 runs at 480 MHz
 	uint32_t cyclesUsed = NT_getCpuCycleCount() - cycleStart;
@@ -2137,8 +4845,19 @@ bool draw(_NT_algorithm* self)
 			float tp = pp * formantRatio;
 			tp -= (int)tp;
 			if (tp < 0.0f) tp += 1.0f;
-			s = readTableMorph(dram->pulsaretTables, pulsaretIdx, tp);
-			s *= readWindowMorph(dram->windowTables, windowIdx, pp);
+			if (pThis->displayAdditive)
+				s = readTableLerp(dram->additiveWork[pThis->additiveWorkFront], kTableSize, tp);
+			else if (pThis->displayPulsaretWork)
+				s = readTableLerp(dram->pulsaretWork[pThis->pulsaretWorkFront], kTableSize, tp);
+			else if (pThis->spectralMorph)
+				s = readGridMorph(pThis->morphGrid, (kNumPulsarets - 1) * pThis->morphSteps,
+				                  pulsaretIdx * pThis->morphSteps, tp, false);
+			else
+				s = readTableMorph(dram->pulsaretTables, pulsaretIdx, tp);
+			if (pThis->windowType != 0)
+				s *= readTableLerp(dram->windowWork[pThis->windowWorkFront], kTableSize, pp);
+			else
+				s *= readWindowMorph(dram->windowTables, windowIdx, pp);
 		}
 		int pixY = waveY - (int)(s * waveH / 2);
 		if (x > 0)
@@ -2189,6 +4908,8 @@ bool draw(_NT_algorithm* self)
 		NT_drawText(barX + barW + 12, barY, "FR", 15, kNT_textLeft, kNT_textTiny);
 	else if (pThis->v[kParamGateMode] == 2)
 		NT_drawText(barX + barW + 12, barY, "CV", 15, kNT_textLeft, kNT_textTiny);
+	else if (pThis->v[kParamGateMode] == 3)
+		NT_drawText(barX + barW + 12, barY, "PCV", 15, kNT_textLeft, kNT_textTiny);
 
 	// Chord type label (Free Run mode, dimmed when only 1 voice)
 	if (pThis->v[kParamGateMode] == 1)
@@ -2267,7 +4988,7 @@ bool draw(_NT_algorithm* self)
 // standard disting NT page navigation behavior.
 //
 //   Pot L:             Pulsaret morph (0.0–9.0)
-//   Pot C:             Duty Cycle (1–100%)
+//   Pot C:             Duty Cycle (1–400%)
 //   Pot R:             Window morph (0.0–4.0)
 //   Encoder Button L:  Cycle mask mode (Off → Stochastic → Burst)
 //   Encoder Button R:  Cycle formant count (1 → 2 → 3)
@@ -2296,10 +5017,10 @@ void customUi(_NT_algorithm* self, const _NT_uiData& data)
 		NT_setParameterFromUi(algIdx, kParamPulsaret + offset, (int16_t)value);
 	}
 
-	// Pot C: Duty Cycle (1–100%)
+	// Pot C: Duty Cycle (1–400%)
 	if (data.controls & kNT_potC)
 	{
-		int value = (int)(data.pots[1] * 99.0f + 0.5f) + 1;
+		int value = (int)(data.pots[1] * 399.0f + 0.5f) + 1;
 		NT_setParameterFromUi(algIdx, kParamDutyCycle + offset, (int16_t)value);
 	}
 
@@ -2343,7 +5064,7 @@ void setupUi(_NT_algorithm* self, _NT_float3& pots)
 {
 	// Sync pot soft-takeover positions
 	pots[0] = self->v[kParamPulsaret] / 90.0f;  // Pulsaret
-	pots[1] = (self->v[kParamDutyCycle] - 1) / 99.0f;  // Duty Cycle
+	pots[1] = (self->v[kParamDutyCycle] - 1) / 399.0f;  // Duty Cycle
 	pots[2] = self->v[kParamWindow] / 40.0f;  // Window
 }
 
@@ -2355,12 +5076,18 @@ void setupUi(_NT_algorithm* self, _NT_float3& pots)
 // host calls to discover this plugin's factories.
 // ============================================================
 
+static const _NT_specification specifications[] = {
+	{ .name = "Morph steps", .min = 1, .max = kMorphStepsMax, .def = kMorphStepsDefault, .type = kNT_typeGeneric },
+	{ .name = "Period cache", .min = 0, .max = 1, .def = 1, .type = kNT_typeGeneric },
+};
+
 static const _NT_factory factory =
 {
 	.guid = NT_MULTICHAR('S', 'r', 'P', 's'),
 	.name = "Spaluter",
 	.description = "Pulsar synthesis with formants, masking, and CV",
-	.numSpecifications = 0,
+	.numSpecifications = ARRAY_SIZE(specifications),
+	.specifications = specifications,
 	.calculateRequirements = calculateRequirements,
 	.construct = construct,
 	.parameterChanged = parameterChanged,